@@ -16,6 +16,12 @@
   #define DBG_PRINT(msg)  ((void)0)
 #endif
 
+// Re-check the incremental state hash against a full recompute after every
+// mutating game_* call (costs ~150 key evaluations per call)
+#ifndef ZOBRIST_VERIFY
+  #define ZOBRIST_VERIFY DEBUG
+#endif
+
 // =============================================================================
 // PIN DEFINITIONS
 // =============================================================================
@@ -64,6 +70,8 @@
 #define TOTAL_HOTELS         12
 #define NUM_CHANCE_CARDS     16
 #define NUM_COMMUNITY_CARDS  16
+#define MAX_JAIL_TURNS       5      // upper bound of settings.jailMaxTurns
+#define ZOBRIST_MONEY_BUCKET 50     // $ per money step seen by the state hash
 
 // =============================================================================
 // NFC CARD TYPES  (byte 0 of sector 1 block 4)
@@ -77,9 +85,42 @@
 // =============================================================================
 #define BTN_DEBOUNCE_MS      50
 #define TOUCH_DEBOUNCE_MS    100
+#define TOUCH_POLL_MS        30     // touch read period while the pen is down (LVGL's default)
+#define TOUCH_Z_MIN          40     // XPT2046 pressure that counts as contact
+#define TOUCH_SAMPLES        5      // raw conversions per read, median taken
 #define SPLASH_DURATION_MS   2500
 #define DICE_ANIM_MS         1200
+#define RENT_SHOW_MS         900    // balances after paying rent, before the next turn
 #define NFC_POLL_INTERVAL_MS 300
+#define NFC_POLL_TIMEOUT_MS  100    // one PN532 detect, on the NFC task
+#define POWER_POLL_MS        1200   // charger status / VBAT
+
+// =============================================================================
+// TASKS  (render on the loop core, card I/O on the other)
+// =============================================================================
+#define RENDER_TASK_CORE     1
+#define RENDER_TASK_PRIO     2      // above loop(), which only reports
+#define RENDER_TASK_STACK    8192
+#define NFC_TASK_CORE        0
+#define NFC_TASK_PRIO        1
+#define NFC_TASK_STACK       4096
+
+// =============================================================================
+// SLEEP / BACKLIGHT  (render loop sleeps to its next deadline; inputs wake it)
+// =============================================================================
+#define BL_LEDC_CH           1      // tone() has channel 0
+#define BL_PWM_HZ            5000
+#define BL_FULL              255
+#define BL_DIM               40
+#define DIM_AFTER_MS         30000  // no input: backlight to BL_DIM
+#define SLEEP_AFTER_MS       90000  // no input: backlight off, light sleep between deadlines
+#define WAKE_RESPONSE_MS     500    // a wake with no frame within this is not timed
+
+// Current model behind PowerStats.avgMa (datasheet figures, not measured)
+#define POWER_MA_RUN         45     // CPU busy at 240 MHz
+#define POWER_MA_WAIT        20     // cores idle in WAITI
+#define POWER_MA_SLEEP       1      // light sleep, peripherals included
+#define POWER_MA_BACKLIGHT   35     // backlight at BL_FULL
 
 // =============================================================================
 // RGB565 COLOUR HELPER
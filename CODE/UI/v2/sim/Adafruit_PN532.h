@@ -0,0 +1,2 @@
+#pragma once
+// SIMULATOR — nfc_sim.cpp stands in for the PN532 (see sim.h)
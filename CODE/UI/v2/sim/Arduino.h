@@ -0,0 +1,53 @@
+#pragma once
+// =============================================================================
+// SIMULATOR — Arduino core subset used by the game, storage and UI sources
+// =============================================================================
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define F(s) (s)
+
+uint32_t millis();
+uint32_t micros();
+void     delay(uint32_t ms);
+
+long     random(long howBig);
+long     random(long howSmall, long howBig);
+void     randomSeed(unsigned long seed);
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t b) = 0;
+    virtual size_t write(const uint8_t* buf, size_t len) {
+        size_t n = 0;
+        while (n < len && write(buf[n])) n++;
+        return n;
+    }
+    size_t print(const char* s)   { return write((const uint8_t*)s, strlen(s)); }
+    size_t println(const char* s) { size_t n = print(s); return n + println(); }
+    size_t println()              { return write((const uint8_t*)"\r\n", 2); }
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+// Serial goes to stdout
+class SimSerial : public Print {
+public:
+    void   begin(unsigned long) {}
+    size_t write(uint8_t b) override { return fputc(b, stdout) == EOF ? 0 : 1; }
+    size_t write(const uint8_t* buf, size_t len) override {
+        size_t n = fwrite(buf, 1, len, stdout);
+        fflush(stdout);
+        return n;
+    }
+    using Print::write;
+};
+
+extern SimSerial Serial;
@@ -0,0 +1,95 @@
+#include "Preferences.h"
+#include <sys/stat.h>
+
+// File layout: per key [u8 key length][key][u32 value length][value]
+
+static std::string _dir() {
+    const char* d = getenv("MONO_SIM_NVS");
+    return (d && d[0]) ? d : "sim_nvs";
+}
+
+bool Preferences::begin(const char* name, bool readOnly) {
+    if (_open) end();
+    std::string dir = _dir();
+    mkdir(dir.c_str(), 0755);
+    _path     = dir + "/" + name + ".nvs";
+    _readOnly = readOnly;
+    _dirty    = false;
+    _keys.clear();
+
+    FILE* f = fopen(_path.c_str(), "rb");
+    if (f) {
+        uint8_t  klen;
+        uint32_t vlen;
+        char     key[256];
+        while (fread(&klen, 1, 1, f) == 1 && fread(key, 1, klen, f) == klen
+               && fread(&vlen, sizeof(vlen), 1, f) == 1) {
+            std::vector<uint8_t> v(vlen);
+            if (vlen && fread(v.data(), 1, vlen, f) != vlen) break;
+            _keys[std::string(key, klen)] = v;
+        }
+        fclose(f);
+    }
+    _open = true;
+    return true;
+}
+
+void Preferences::end() {
+    if (_open && _dirty && !_readOnly) {
+        FILE* f = fopen(_path.c_str(), "wb");
+        if (f) {
+            for (const auto& kv : _keys) {
+                uint8_t  klen = (uint8_t)kv.first.size();
+                uint32_t vlen = (uint32_t)kv.second.size();
+                fwrite(&klen, 1, 1, f);
+                fwrite(kv.first.data(), 1, klen, f);
+                fwrite(&vlen, sizeof(vlen), 1, f);
+                fwrite(kv.second.data(), 1, vlen, f);
+            }
+            fclose(f);
+        } else {
+            Serial.printf("[NVS] cannot write %s\n", _path.c_str());
+        }
+    }
+    _keys.clear();
+    _open = false;
+}
+
+bool Preferences::clear() {
+    if (!_open || _readOnly) return false;
+    _keys.clear();
+    _dirty = true;
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!_open || _readOnly || !_keys.erase(key)) return false;
+    _dirty = true;
+    return true;
+}
+
+bool Preferences::isKey(const char* key) {
+    return _open && _keys.count(key);
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+    if (!_open || _readOnly || strlen(key) > 15) return 0;  // NVS key limit
+    const uint8_t* p = (const uint8_t*)value;
+    _keys[key] = std::vector<uint8_t>(p, p + len);
+    _dirty = true;
+    return len;
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+    auto it = _keys.find(key);
+    if (!_open || it == _keys.end()) return 0;
+    size_t len = it->second.size();
+    if (len > maxLen) return 0;                             // as on the device
+    memcpy(buf, it->second.data(), len);
+    return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    auto it = _keys.find(key);
+    return (_open && it != _keys.end()) ? it->second.size() : 0;
+}
@@ -0,0 +1,31 @@
+#pragma once
+// =============================================================================
+// SIMULATOR — ESP32 Preferences backed by one file per namespace
+// =============================================================================
+// Files live in $MONO_SIM_NVS (default ./sim_nvs) as <namespace>.nvs, so saved
+// games and settings survive a restart like they do in flash.
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class Preferences {
+public:
+    bool   begin(const char* name, bool readOnly = false);
+    void   end();                               // writes the file if changed
+
+    bool   clear();
+    bool   remove(const char* key);
+    bool   isKey(const char* key);
+
+    size_t putBytes(const char* key, const void* value, size_t len);
+    size_t getBytes(const char* key, void* buf, size_t maxLen);
+    size_t getBytesLength(const char* key);
+
+private:
+    std::string _path;
+    bool        _open     = false;
+    bool        _readOnly = true;
+    bool        _dirty    = false;
+    std::map<std::string, std::vector<uint8_t>> _keys;
+};
@@ -0,0 +1,3 @@
+#pragma once
+// SIMULATOR — hardware.h names the panel driver; the SDL window replaces it
+class TFT_eSPI {};
@@ -0,0 +1,2 @@
+#pragma once
+// SIMULATOR — no I2C bus; the NFC reader and charger are simulated
@@ -0,0 +1,56 @@
+#include <Arduino.h>
+#include "sim.h"
+#include <stdarg.h>
+#include <chrono>
+#include <thread>
+
+SimSerial Serial;
+
+static const auto _boot = std::chrono::steady_clock::now();
+static bool       _virtual   = false;
+static uint32_t   _virtualMs = 0;
+
+uint32_t millis() {
+    if (_virtual) return _virtualMs;
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - _boot).count();
+}
+
+uint32_t micros() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - _boot).count();
+}
+
+void delay(uint32_t ms) {
+    if (_virtual) _virtualMs += ms;
+    else          std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void sim_virtualClock() {
+    _virtualMs = millis();
+    _virtual   = true;
+}
+
+void sim_advance(uint32_t ms) { _virtualMs += ms; }
+
+long random(long howBig) {
+    return howBig > 0 ? rand() % howBig : 0;
+}
+
+long random(long howSmall, long howBig) {
+    return howSmall < howBig ? howSmall + random(howBig - howSmall) : howSmall;
+}
+
+void randomSeed(unsigned long seed) {
+    srand((unsigned)seed);
+}
+
+size_t Print::printf(const char* fmt, ...) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n <= 0) return 0;
+    return write((const uint8_t*)buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+}
@@ -0,0 +1,49 @@
+// =============================================================================
+// SIMULATOR — headless display: the board's buffers, flushed into memory
+// =============================================================================
+#include "hardware.h"
+#include "sim.h"
+
+// Same partial buffers as hardware.cpp, so LVGL splits frames the same way
+static uint8_t  _lvBuf[2][SCREEN_W * 24 * 2];
+static uint16_t _fb[SCREEN_W * SCREEN_H];       // the "panel"
+
+static DisplayStats _stats;
+static uint64_t     _pixels = 0;
+
+DisplayStats hw_displayStats() { return _stats; }
+uint64_t hw_simFlushedPixels() { return _pixels; }
+
+static void _lvgl_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    int32_t w = lv_area_get_width(area);
+    const uint16_t* src = (const uint16_t*)px_map;
+    for (int32_t y = area->y1; y <= area->y2; y++, src += w) {
+        memcpy(&_fb[y * SCREEN_W + area->x1], src, w * 2);
+    }
+    _stats.flushes++;
+    _pixels += (uint64_t)lv_area_get_size(area);
+    if (lv_display_flush_is_last(disp)) _stats.frames++;
+    lv_display_flush_ready(disp);
+}
+
+static uint32_t _lvgl_tick_cb(void) {
+    return millis();
+}
+
+// No touch, no buttons: the harness drives the engine directly
+TouchPoint hw_getTouch()                 { return TouchPoint(); }
+BtnId      hw_readButtons()              { return BTN_NONE; }
+bool       hw_isBtnHeld(BtnId, uint32_t) { return false; }
+
+void hw_lvgl_init() {
+    lv_init();
+    lv_tick_set_cb(_lvgl_tick_cb);
+
+    lv_display_t* disp = lv_display_create(SCREEN_W, SCREEN_H);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, _lvBuf[0], _lvBuf[1], sizeof(_lvBuf[0]),
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, _lvgl_flush_cb);
+
+    lv_group_set_default(lv_group_create());
+}
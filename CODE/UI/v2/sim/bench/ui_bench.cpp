@@ -0,0 +1,263 @@
+// =============================================================================
+// MONOPOLY ELECTRONIC V2 — Headless UI benchmark
+// =============================================================================
+// Drives the engine into every screen, then times the build (ui_update) and
+// one full render into the memory display, and records the screen's object
+// count, LVGL heap and flushed pixels. The clock is virtual and the seed
+// fixed, so everything except the times is the same on every run.
+//   pio run -e ui_bench -t execute          -> ui_bench.json
+//
+// Pass 1 is cold (pooled screens built); the later passes revisit them (pool
+// refresh), and their times are reported as the median. switch_us and
+// frag_pct are ui_poolStats()'s phase-switch time and LVGL heap
+// fragmentation; ui_bench_nopool / ui_bench_notheme rebuild with the pool or
+// the shared styles off for the comparison.
+#include <Arduino.h>
+#include <lvgl.h>
+#include "config.h"
+#include "hardware.h"
+#include "nfc_handler.h"
+#include "game_logic.h"
+#include "ui.h"
+#include "ui_theme.h"
+#include "sim.h"
+#include <algorithm>
+
+#define BENCH_SEED     12345
+#define BENCH_PASSES   6            // 1 cold + 5 warm
+#ifndef BENCH_OUT
+  #define BENCH_OUT    "ui_bench.json"
+#endif
+
+struct Sample {
+    uint32_t buildUs;
+    uint32_t renderUs;
+    uint32_t objects;
+    uint32_t heapUsed;
+    uint32_t heapPeak;              // LVGL's high-water mark so far
+    uint32_t switchUs;              // phase change to screen loaded, inside ui_update()
+    uint8_t  fragPct;
+    uint32_t flushes;
+    uint64_t pixels;
+};
+
+struct Scenario {
+    const char* name;
+    void (*setup)();
+};
+
+// =============================================================================
+// ENGINE STATES
+// =============================================================================
+// A 4-player game a few turns in: a brown set with a house, a light-blue
+// set, and single properties for the others
+static void _game() {
+    game_newGame(4);
+    game_buyProperty(0, 1);
+    game_buyProperty(0, 3);
+    game_buildHouse(0, 1);
+    game_buyProperty(1, 6);
+    game_buyProperty(1, 8);
+    game_buyProperty(1, 9);
+    game_buyProperty(2, 11);
+    game_buyProperty(3, 5);
+}
+
+// Fields set directly (no game_* mutator moves a token without a roll) leave
+// the hash and standings behind: rebuild both, as after a load
+static void _settle() {
+    game_rehash();
+    game_recomputeStandings();
+}
+
+static void _tile(uint8_t tile, TileAction act) {
+    _game();
+    G.players[G.currentPlayer].position = tile;
+    _settle();
+    G.tileAction = act;
+    game_setPhase(PHASE_TILE_ACTION);
+}
+
+static void _card(bool chance) {
+    _game();
+    G.players[G.currentPlayer].position = chance ? 7 : 2;
+    _settle();
+    G.cardIsChance = chance;
+    G.cardIndex    = 0;
+    game_setPhase(PHASE_CARD_DRAW);
+}
+
+static void _trade(GamePhase ph) {
+    _game();
+    G.tradeWith         = 1;
+    G.tradeMoneyOffer   = 100;
+    G.tradeMoneyRequest = 50;
+    G.tradePropsOffer   = 1ULL << 3;
+    G.tradePropsRequest = 1ULL << 6;
+    game_setPhase(ph);
+}
+
+static const Scenario SCENARIOS[] = {
+    { "splash",         [] { game_init(); game_setPhase(PHASE_SPLASH); } },
+    { "menu",           [] { game_init(); game_setPhase(PHASE_MENU); } },
+    { "setup_count",    [] { game_init(); game_setPhase(PHASE_SETUP_COUNT); } },
+    { "setup_players",  [] { game_newGame(4); game_setPhase(PHASE_SETUP_PLAYERS); } },
+    { "turn_start",     [] { _game(); } },
+    { "rolling",        [] { _game(); G.dice1 = 3; G.dice2 = 4; game_setPhase(PHASE_ROLLING); } },
+    { "tile_buy",       [] { _tile(16, ACT_BUY); } },
+    { "tile_rent",      [] { _tile(6,  ACT_PAY_RENT); } },
+    { "tile_own",       [] { _tile(1,  ACT_OWN_PROP); } },
+    { "tile_tax",       [] { _tile(4,  ACT_TAX); } },
+    { "tile_parking",   [] { _tile(20, ACT_FREE_PARKING); } },
+    { "tile_go_to_jail",[] { _tile(30, ACT_GO_TO_JAIL); } },
+    { "tile_visiting",  [] { _tile(10, ACT_JUST_VISITING); } },
+    { "card_chance",    [] { _card(true); } },
+    { "card_community", [] { _card(false); } },
+    { "jail_turn",      [] {
+        _game();
+        game_sendToJail(0);
+        game_setPhase(PHASE_JAIL_TURN);
+    } },
+    { "trade_select",   [] { _trade(PHASE_TRADE_SELECT); } },
+    { "trade_offer",    [] { _trade(PHASE_TRADE_OFFER); } },
+    { "quick_menu",     [] { _game(); game_setPhase(PHASE_QUICK_MENU); } },
+    { "programming",    [] { game_init(); game_setPhase(PHASE_PROGRAMMING); } },
+    { "settings",       [] { game_init(); game_setPhase(PHASE_SETTINGS); } },
+    { "game_over",      [] {
+        _game();
+        for (uint8_t i = 1; i < G.numPlayers; i++) G.players[i].alive = false;
+        G.alivePlayers = 1;
+        _settle();                  // bankrupt players rank last
+        game_setPhase(PHASE_GAME_OVER);
+    } },
+    { "game_stats",     [] { _game(); game_setPhase(PHASE_GAME_STATS); } },
+};
+#define N_SCENARIOS (sizeof(SCENARIOS) / sizeof(SCENARIOS[0]))
+
+// =============================================================================
+// MEASUREMENT
+// =============================================================================
+static uint32_t _countObjects(lv_obj_t* obj) {
+    uint32_t n = 1;
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) n += _countObjects(lv_obj_get_child(obj, i));
+    return n;
+}
+
+static Sample _measure() {
+    Sample s = {};
+    DisplayStats d0 = hw_displayStats();
+    uint64_t     p0 = hw_simFlushedPixels();
+
+    uint32_t t0 = micros();
+    ui_update();                    // build or refresh + load
+    uint32_t t1 = micros();
+    lv_refr_now(nullptr);           // the whole new screen, flushed
+    uint32_t t2 = micros();
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    s.buildUs  = t1 - t0;
+    s.renderUs = t2 - t1;
+    s.objects  = _countObjects(lv_screen_active());
+    s.heapUsed = mon.total_size - mon.free_size;
+    s.heapPeak = mon.max_used;
+    s.fragPct  = mon.frag_pct;
+    s.switchUs = ui_poolStats().lastSwitchUs;
+    s.flushes  = hw_displayStats().flushes - d0.flushes;
+    s.pixels   = hw_simFlushedPixels() - p0;
+    return s;
+}
+
+static uint32_t _median(uint32_t* v, uint8_t n) {
+    std::sort(v, v + n);
+    return v[n / 2];
+}
+
+// =============================================================================
+// REPORT
+// =============================================================================
+static void _jsonSample(FILE* f, const char* key, const Sample& s) {
+    fprintf(f, "\"%s\": {\"build_us\": %lu, \"render_us\": %lu, \"objects\": %lu, "
+               "\"heap_used\": %lu, \"heap_peak\": %lu, \"frag_pct\": %u, \"switch_us\": %lu, "
+               "\"flushes\": %lu, \"pixels\": %llu}",
+            key, (unsigned long)s.buildUs, (unsigned long)s.renderUs, (unsigned long)s.objects,
+            (unsigned long)s.heapUsed, (unsigned long)s.heapPeak, (unsigned)s.fragPct,
+            (unsigned long)s.switchUs, (unsigned long)s.flushes, (unsigned long long)s.pixels);
+}
+
+int main(int argc, char** argv) {
+    const char* out = argc > 1 ? argv[1] : BENCH_OUT;
+    sim_virtualClock();
+    randomSeed(BENCH_SEED);
+
+    nfc_init();
+    nfc_startTask();
+    hw_initPower();
+    hw_initDisplay();
+    hw_initTouch();
+    hw_initButtons();
+    hw_initAudio();
+    hw_lvgl_init();
+    hw_setVolume(0);
+
+    game_init();
+    ui_init();
+
+    static Sample cold[N_SCENARIOS], warm[N_SCENARIOS];
+    static uint32_t build[N_SCENARIOS][BENCH_PASSES - 1], render[N_SCENARIOS][BENCH_PASSES - 1];
+    static uint32_t swtch[N_SCENARIOS][BENCH_PASSES - 1];
+    for (uint8_t pass = 0; pass < BENCH_PASSES; pass++) {
+        for (uint8_t i = 0; i < N_SCENARIOS; i++) {
+            SCENARIOS[i].setup();
+            Sample s = _measure();
+            if (pass == 0) { cold[i] = s; continue; }
+            warm[i] = s;
+            build[i][pass - 1]  = s.buildUs;
+            render[i][pass - 1] = s.renderUs;
+            swtch[i][pass - 1]  = s.switchUs;
+        }
+    }
+
+    FILE* f = fopen(out, "w");
+    if (!f) {
+        Serial.printf("ui_bench: cannot write %s\n", out);
+        return 1;
+    }
+    const UiPoolStats& ps = ui_poolStats();
+    fprintf(f, "{\n  \"seed\": %d, \"passes\": %d, \"screen\": [%d, %d], "
+               "\"ptr_bits\": %d, \"lv_mem_size\": %lu,\n"
+               "  \"pool_slots\": %u, \"theme_shared\": %d,\n"
+               "  \"pool\": {\"hits\": %lu, \"builds\": %lu, \"evictions\": %lu, "
+               "\"max_switch_us\": %lu, \"max_frag_pct\": %u, \"max_screen_bytes\": %lu},\n"
+               "  \"screens\": [\n",
+            BENCH_SEED, BENCH_PASSES, SCREEN_W, SCREEN_H,
+            (int)(sizeof(void*) * 8), (unsigned long)LV_MEM_SIZE,
+            (unsigned)ps.slots, UI_THEME_SHARED,
+            (unsigned long)ps.hits, (unsigned long)ps.builds, (unsigned long)ps.evictions,
+            (unsigned long)ps.maxSwitchUs, (unsigned)ps.maxFragPct, (unsigned long)ps.maxScreenBytes);
+
+    Serial.printf("%-16s %9s %9s %9s %9s %9s %7s %8s %5s\n",
+                  "screen", "build us", "warm us", "render us", "warm us", "switch us",
+                  "objects", "heap B", "frag%");
+    for (uint8_t i = 0; i < N_SCENARIOS; i++) {
+        warm[i].buildUs  = _median(build[i], BENCH_PASSES - 1);
+        warm[i].renderUs = _median(render[i], BENCH_PASSES - 1);
+        warm[i].switchUs = _median(swtch[i], BENCH_PASSES - 1);
+
+        fprintf(f, "    {\"name\": \"%s\", ", SCENARIOS[i].name);
+        _jsonSample(f, "cold", cold[i]);
+        fprintf(f, ", ");
+        _jsonSample(f, "warm", warm[i]);
+        fprintf(f, "}%s\n", i + 1u < N_SCENARIOS ? "," : "");
+
+        Serial.printf("%-16s %9lu %9lu %9lu %9lu %9lu %7lu %8lu %5u\n", SCENARIOS[i].name,
+                      (unsigned long)cold[i].buildUs, (unsigned long)warm[i].buildUs,
+                      (unsigned long)cold[i].renderUs, (unsigned long)warm[i].renderUs,
+                      (unsigned long)warm[i].switchUs, (unsigned long)warm[i].objects,
+                      (unsigned long)warm[i].heapUsed, (unsigned)warm[i].fragPct);
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    Serial.printf("ui_bench: %u screens -> %s\n", (unsigned)N_SCENARIOS, out);
+    return 0;
+}
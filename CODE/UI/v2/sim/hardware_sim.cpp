@@ -0,0 +1,60 @@
+// =============================================================================
+// SIMULATOR — hardware.h parts without a device behind them (SDL and bench)
+// =============================================================================
+#include "hardware.h"
+
+// =============================================================================
+// POWER  (mains-powered, full battery)
+// =============================================================================
+static BatteryInfo _batt;
+
+void hw_initPower() {
+    _batt.present   = true;
+    _batt.powerGood = true;
+    _batt.percent   = 100;
+    _batt.voltage   = 4.20f;
+}
+
+void hw_updatePower() { _batt.lastUpdateMs = millis(); }
+
+BatteryInfo hw_getBatteryInfo() { return _batt; }
+
+// =============================================================================
+// DISPLAY / INPUT INIT  (window or memory display made in hw_lvgl_init)
+// =============================================================================
+void hw_initDisplay() {}
+void hw_backlight(bool on) { DBG("Backlight %s", on ? "on" : "off"); }
+void hw_setBacklight(uint8_t level) { DBG("Backlight %u", level); }
+
+void hw_initTouch() {}
+void hw_initButtons() {}
+
+bool hw_touchInRect(int16_t tx, int16_t ty,
+                    int16_t rx, int16_t ry, int16_t rw, int16_t rh) {
+    return tx >= rx && tx < rx + rw && ty >= ry && ty < ry + rh;
+}
+
+// =============================================================================
+// AUDIO  (logged, not played)
+// =============================================================================
+static uint8_t _volume = 3;
+
+void hw_initAudio() {}
+void hw_setVolume(uint8_t vol) { _volume = vol > 5 ? 5 : vol; }
+
+void hw_playMelody(const Note* melody, uint8_t len) {
+    if (_volume) DBG("Sound: %u notes", len);
+}
+
+static void _sound(const char* name) {
+    if (_volume) DBG("Sound: %s", name);
+}
+
+void hw_playJingle()   { _sound("jingle"); }
+void hw_playDiceRoll() { _sound("dice"); }
+void hw_playCashIn()   { _sound("cash in"); }
+void hw_playCashOut()  { _sound("cash out"); }
+void hw_playCardDraw() { _sound("card"); }
+void hw_playError()    { _sound("error"); }
+void hw_playSuccess()  { _sound("success"); }
+void hw_playJail()     { _sound("jail"); }
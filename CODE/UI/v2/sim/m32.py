@@ -0,0 +1,6 @@
+# sim32: compile, assemble and link every object (LVGL included) for a 32-bit
+# host. -m32 in build_flags only reaches the compiler; the linker would still
+# produce a 64-bit binary. Needs gcc-multilib, g++-multilib and libsdl2-dev:i386.
+Import("env")
+
+env.Append(CCFLAGS=["-m32"], ASFLAGS=["-m32"], LINKFLAGS=["-m32"])
@@ -0,0 +1,242 @@
+// =============================================================================
+// SIMULATOR — virtual PN532: scripted / keyboard card taps, same job API
+// =============================================================================
+#include "nfc_handler.h"
+#include "spsc_queue.h"
+#include "sim.h"
+#include <vector>
+
+struct _SimCard {
+    uint8_t         uid[4];
+    uint8_t         type;           // 0 = blank, else NFC_TYPE_*
+    NfcPlayerCard   player;
+    NfcPropertyCard property;
+    NfcEventCard    event;
+};
+
+struct _SimTap {
+    uint32_t at;                    // ms after nfc_init()
+    uint8_t  card;
+};
+
+static _SimCard _cards[SIM_NFC_CARDS];
+static int8_t   _onReader = -1;     // card index, -1 = none
+static uint32_t _tapUntil = 0;
+
+static std::vector<_SimTap> _script;
+static size_t   _scriptNext = 0;
+static uint32_t _t0         = 0;
+
+// Cards as programmed on the device: token name + player colour
+static const char* const _tokens[MAX_PLAYERS] = {
+    "Car", "Hat", "Ship", "Boot", "Dog", "Star", "Plane", "Iron"
+};
+
+static void _playerCard(uint8_t i, uint8_t id, uint16_t colour, const char* name) {
+    _SimCard& c = _cards[i];
+    memset(&c.player, 0, sizeof(c.player));
+    c.type            = NFC_TYPE_PLAYER;
+    c.player.type     = NFC_TYPE_PLAYER;
+    c.player.playerId = id;
+    c.player.colour   = colour;
+    strncpy(c.player.name, name, MAX_NAME_LEN);
+}
+
+// =============================================================================
+// CARDS + READER
+// =============================================================================
+bool nfc_init() {
+    for (uint8_t i = 0; i < SIM_NFC_CARDS; i++) {
+        _SimCard& c = _cards[i];
+        memset(&c, 0, sizeof(c));
+        c.uid[0] = 0x5A; c.uid[1] = 0x1A; c.uid[2] = 0x00; c.uid[3] = i + 1;
+        if (i < MAX_PLAYERS) _playerCard(i, i, PLAYER_COLOURS[i], _tokens[i]);
+    }
+    _t0 = millis();
+    Serial.println(F("[NFC] virtual reader: keys 1-9, 0 tap cards"));
+    return true;
+}
+
+bool nfc_available() { return true; }
+
+void nfc_simTap(uint8_t card) {
+    if (card < 1 || card > SIM_NFC_CARDS) return;
+    _onReader = card - 1;
+    _tapUntil = millis() + SIM_NFC_TAP_MS;
+    DBG("NFC sim: card %u on the reader", card);
+}
+
+bool nfc_pollCard(uint8_t* uid, uint8_t* uidLen, uint16_t timeoutMs) {
+    if (_onReader < 0) return false;
+    memcpy(uid, _cards[_onReader].uid, 4);
+    *uidLen = 4;
+    return true;
+}
+
+static _SimCard* _card(const uint8_t* uid, uint8_t uidLen) {
+    if (uidLen != 4) return nullptr;
+    for (uint8_t i = 0; i < SIM_NFC_CARDS; i++) {
+        if (memcmp(_cards[i].uid, uid, 4) == 0) return &_cards[i];
+    }
+    return nullptr;
+}
+
+uint8_t nfc_readCardType(uint8_t* uid, uint8_t uidLen) {
+    _SimCard* c = _card(uid, uidLen);
+    return c ? c->type : 0;
+}
+
+bool nfc_readPlayerCard(uint8_t* uid, uint8_t uidLen, NfcPlayerCard& out) {
+    _SimCard* c = _card(uid, uidLen);
+    if (!c || c->type != NFC_TYPE_PLAYER) return false;
+    out = c->player;
+    return true;
+}
+
+bool nfc_readPropertyCard(uint8_t* uid, uint8_t uidLen, NfcPropertyCard& out) {
+    _SimCard* c = _card(uid, uidLen);
+    if (!c || c->type != NFC_TYPE_PROPERTY) return false;
+    out = c->property;
+    return true;
+}
+
+bool nfc_readEventCard(uint8_t* uid, uint8_t uidLen, NfcEventCard& out) {
+    _SimCard* c = _card(uid, uidLen);
+    if (!c || c->type != NFC_TYPE_EVENT) return false;
+    out = c->event;
+    return true;
+}
+
+bool nfc_writePlayerCard(uint8_t* uid, uint8_t uidLen, const NfcPlayerCard& data) {
+    _SimCard* c = _card(uid, uidLen);
+    if (!c) return false;
+    c->type   = NFC_TYPE_PLAYER;
+    c->player = data;
+    return true;
+}
+
+bool nfc_writePropertyCard(uint8_t* uid, uint8_t uidLen, const NfcPropertyCard& data) {
+    _SimCard* c = _card(uid, uidLen);
+    if (!c) return false;
+    c->type     = NFC_TYPE_PROPERTY;
+    c->property = data;
+    return true;
+}
+
+bool nfc_writeEventCard(uint8_t* uid, uint8_t uidLen, const NfcEventCard& data) {
+    _SimCard* c = _card(uid, uidLen);
+    if (!c) return false;
+    c->type  = NFC_TYPE_EVENT;
+    c->event = data;
+    return true;
+}
+
+// =============================================================================
+// SCRIPT
+// =============================================================================
+bool nfc_simLoadScript(const char* path) {
+    if (!path || !path[0]) return false;
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        Serial.printf("[NFC] script %s not found\n", path);
+        return false;
+    }
+    char line[128];
+    unsigned lineNo = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineNo++;
+        char* hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+
+        unsigned n, id, colour;
+        unsigned long at;
+        char name[MAX_NAME_LEN + 1];
+        char word[8];
+        if (sscanf(line, " card %u player %u %x %12s", &n, &id, &colour, name) == 4
+            && n >= 1 && n <= SIM_NFC_CARDS && id < MAX_PLAYERS) {
+            _playerCard(n - 1, id, (uint16_t)colour, name);
+        } else if (sscanf(line, " card %u %7s", &n, word) == 2 && strcmp(word, "blank") == 0
+                   && n >= 1 && n <= SIM_NFC_CARDS) {
+            _cards[n - 1].type = 0;
+        } else if (sscanf(line, " %lu tap %u", &at, &n) == 2 && n >= 1 && n <= SIM_NFC_CARDS) {
+            _script.push_back({(uint32_t)at, (uint8_t)n});
+        } else if (sscanf(line, " %7s", word) == 1) {
+            Serial.printf("[NFC] script line %u ignored\n", lineNo);
+        }
+    }
+    fclose(f);
+    Serial.printf("[NFC] script %s: %u taps\n", path, (unsigned)_script.size());
+    return true;
+}
+
+// =============================================================================
+// JOBS  (same contract as the NFC task, run from the main loop)
+// =============================================================================
+static SpscQueue<NfcResult, 4> _results;
+static NfcJob   _job      = NFC_JOB_IDLE;
+static uint8_t  _jobSeq   = 0;
+static uint8_t  _seq      = 0;
+static uint32_t _lastPoll = 0;
+static NfcWakeHook _wakeHook = nullptr;
+static union {
+    NfcPlayerCard   player;
+    NfcPropertyCard property;
+    NfcEventCard    event;
+} _jobCard;
+
+bool nfc_startTask() { return true; }
+
+uint8_t nfc_post(NfcJob job, const void* card) {
+    if (++_seq == 0) _seq = 1;
+    _job    = job;
+    _jobSeq = _seq;
+    switch (job) {
+        case NFC_JOB_WRITE_PLAYER:   _jobCard.player   = *(const NfcPlayerCard*)card;   break;
+        case NFC_JOB_WRITE_PROPERTY: _jobCard.property = *(const NfcPropertyCard*)card; break;
+        case NFC_JOB_WRITE_EVENT:    _jobCard.event    = *(const NfcEventCard*)card;    break;
+        default: break;
+    }
+    _lastPoll = millis() - NFC_POLL_INTERVAL_MS;    // poll on the next tick
+    return _seq;
+}
+
+bool nfc_takeResult(NfcResult& out) {
+    return _results.pop(out);
+}
+
+bool nfc_busy() { return _job != NFC_JOB_IDLE; }
+
+void nfc_setWakeHook(NfcWakeHook hook) { _wakeHook = hook; }
+
+void nfc_simTick(uint32_t now) {
+    while (_scriptNext < _script.size() && now - _t0 >= _script[_scriptNext].at) {
+        nfc_simTap(_script[_scriptNext++].card);
+    }
+    if (_onReader >= 0 && (int32_t)(now - _tapUntil) >= 0) _onReader = -1;
+
+    if (_job == NFC_JOB_IDLE || now - _lastPoll < NFC_POLL_INTERVAL_MS) return;
+    _lastPoll = now;
+
+    NfcResult r = {};
+    r.seq = _jobSeq;
+    if (!nfc_pollCard(r.uid, &r.uidLen, NFC_POLL_TIMEOUT_MS)) return;
+    switch (_job) {
+        case NFC_JOB_READ_PLAYER:
+            r.ok = nfc_readPlayerCard(r.uid, r.uidLen, r.player);
+            break;
+        case NFC_JOB_WRITE_PLAYER:
+            r.ok = nfc_writePlayerCard(r.uid, r.uidLen, _jobCard.player);
+            break;
+        case NFC_JOB_WRITE_PROPERTY:
+            r.ok = nfc_writePropertyCard(r.uid, r.uidLen, _jobCard.property);
+            break;
+        case NFC_JOB_WRITE_EVENT:
+            r.ok = nfc_writeEventCard(r.uid, r.uidLen, _jobCard.event);
+            break;
+        default:
+            break;
+    }
+    if (_job != NFC_JOB_READ_PLAYER) _job = NFC_JOB_IDLE;
+    if (!_results.push(r)) DBG_PRINT("NFC result dropped (queue full)");
+    else if (_wakeHook) _wakeHook();
+}
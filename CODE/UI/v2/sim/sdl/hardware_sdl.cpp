@@ -0,0 +1,164 @@
+// =============================================================================
+// SIMULATOR — SDL2 window, keyboard buttons, mouse touch, frame-time overlay
+// =============================================================================
+#include "hardware.h"
+#include "ui.h"
+#include "sim.h"
+#include <SDL2/SDL.h>
+
+// =============================================================================
+// TOUCH  (the mouse)
+// =============================================================================
+TouchPoint hw_getTouch() {
+    TouchPoint tp;
+    int x, y;
+    if (SDL_GetMouseState(&x, &y) & SDL_BUTTON(SDL_BUTTON_LEFT)) {
+        tp.x = x / SIM_ZOOM;
+        tp.y = y / SIM_ZOOM;
+        tp.pressed = true;
+    }
+    return tp;
+}
+
+// =============================================================================
+// BUTTONS  (keyboard, debounced like the GPIOs)
+// =============================================================================
+static const SDL_Scancode _btnKeys[3][3] = {
+    { SDL_SCANCODE_LEFT,  SDL_SCANCODE_A,     SDL_SCANCODE_LEFT   },
+    { SDL_SCANCODE_DOWN,  SDL_SCANCODE_SPACE, SDL_SCANCODE_RETURN },
+    { SDL_SCANCODE_RIGHT, SDL_SCANCODE_D,     SDL_SCANCODE_RIGHT  },
+};
+static bool     _btnPrev[3] = {false, false, false};
+static uint32_t _btnTime[3] = {0, 0, 0};
+static bool     _btnDown[3] = {false, false, false};
+
+static bool _key(SDL_Scancode k) {
+    return SDL_GetKeyboardState(nullptr)[k] != 0;
+}
+
+BtnId hw_readButtons() {
+    for (int i = 0; i < 3; i++) {
+        bool cur = _key(_btnKeys[i][0]) || _key(_btnKeys[i][1]) || _key(_btnKeys[i][2]);
+        _btnDown[i] = cur;
+        if (cur && !_btnPrev[i] && (millis() - _btnTime[i] > BTN_DEBOUNCE_MS)) {
+            _btnPrev[i] = true;
+            _btnTime[i] = millis();
+            return (BtnId)(i + 1);
+        }
+        if (!cur) _btnPrev[i] = false;
+    }
+    return BTN_NONE;
+}
+
+bool hw_isBtnHeld(BtnId b, uint32_t ms) {
+    if (b == BTN_NONE || b > BTN_RIGHT) return false;
+    uint8_t idx = b - 1;
+    return _btnDown[idx] && (millis() - _btnTime[idx] >= ms);
+}
+
+// =============================================================================
+// LVGL DRIVERS + FRAME-TIME OVERLAY
+// =============================================================================
+// Render time is RENDER_START -> RENDER_READY on the display; the overlay
+// shows the worst frame of the last half second next to the last screen
+// switch from ui_poolStats().
+static DisplayStats _stats;
+static uint32_t     _frameT0    = 0;
+static uint32_t     _frameMaxUs = 0;
+static lv_obj_t*    _overlay    = nullptr;
+
+DisplayStats hw_displayStats() { return _stats; }
+
+static void _onRender(lv_event_t* e) {
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+        _frameT0 = micros();
+        return;
+    }
+    uint32_t us = micros() - _frameT0;
+    if (us > _frameMaxUs) _frameMaxUs = us;
+    _stats.frames++;
+    _stats.flushes++;
+}
+
+static void _refreshOverlay(lv_timer_t*) {
+    const UiPoolStats& ps = ui_poolStats();
+    lv_label_set_text_fmt(_overlay, "frame %lu.%02lu ms  build %lu.%02lu ms  screen %lu B",
+                          (unsigned long)(_frameMaxUs / 1000), (unsigned long)(_frameMaxUs % 1000 / 10),
+                          (unsigned long)(ps.lastSwitchUs / 1000), (unsigned long)(ps.lastSwitchUs % 1000 / 10),
+                          (unsigned long)ps.screenBytes);
+    _frameMaxUs = 0;
+}
+
+static uint32_t _lvgl_tick_cb(void) {
+    return millis();
+}
+
+static uint32_t _lastKey = 0;
+
+static void _lvgl_keypad_read_cb(lv_indev_t* indev, lv_indev_data_t* data) {
+    BtnId btn = hw_readButtons();
+    if (btn != BTN_NONE) {
+        switch (btn) {
+            case BTN_LEFT:   _lastKey = LV_KEY_LEFT;  break;
+            case BTN_CENTER: _lastKey = LV_KEY_ENTER; break;
+            case BTN_RIGHT:  _lastKey = LV_KEY_RIGHT; break;
+            default: break;
+        }
+        data->state = LV_INDEV_STATE_PRESSED;
+    } else {
+        data->state = LV_INDEV_STATE_RELEASED;
+    }
+    data->key = _lastKey;
+}
+
+void hw_lvgl_init() {
+    lv_init();
+    lv_tick_set_cb(_lvgl_tick_cb);
+
+    lv_display_t* disp = lv_sdl_window_create(SCREEN_W, SCREEN_H);
+    lv_sdl_window_set_zoom(disp, SIM_ZOOM);
+    lv_sdl_window_set_title(disp, "Monopoly Electronic V2");
+    lv_display_add_event_cb(disp, _onRender, LV_EVENT_RENDER_START, nullptr);
+    lv_display_add_event_cb(disp, _onRender, LV_EVENT_RENDER_READY, nullptr);
+
+    lv_sdl_mouse_create();
+
+    lv_indev_t* keypad_indev = lv_indev_create();
+    lv_indev_set_type(keypad_indev, LV_INDEV_TYPE_KEYPAD);
+    lv_indev_set_read_cb(keypad_indev, _lvgl_keypad_read_cb);
+
+    lv_group_t* group = lv_group_create();
+    lv_group_set_default(group);
+    lv_indev_set_group(keypad_indev, group);
+
+    _overlay = lv_label_create(lv_layer_sys());
+    lv_obj_set_style_text_font(_overlay, &lv_font_montserrat_12, 0);
+    lv_obj_set_style_text_color(_overlay, lv_color_hex(0x00FF00), 0);
+    lv_obj_set_style_bg_color(_overlay, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(_overlay, LV_OPA_70, 0);
+    lv_obj_align(_overlay, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+    lv_label_set_text(_overlay, "");
+    lv_timer_create(_refreshOverlay, 500, nullptr);
+
+    DBG("LVGL display: SDL window %dx%d, zoom %d", SCREEN_W, SCREEN_H, SIM_ZOOM);
+}
+
+// Card keys and the overlay toggle, on their press edge
+static bool _keyPrev[SDL_NUM_SCANCODES];
+
+static bool _pressed(SDL_Scancode k) {
+    bool cur = _key(k), edge = cur && !_keyPrev[k];
+    _keyPrev[k] = cur;
+    return edge;
+}
+
+void hw_simTick() {
+    for (uint8_t n = 1; n <= SIM_NFC_CARDS; n++) {
+        // SDL_SCANCODE_1 .. SDL_SCANCODE_9, SDL_SCANCODE_0
+        if (_pressed((SDL_Scancode)(SDL_SCANCODE_1 + n - 1))) nfc_simTap(n);
+    }
+    if (_pressed(SDL_SCANCODE_P)) {
+        if (lv_obj_has_flag(_overlay, LV_OBJ_FLAG_HIDDEN)) lv_obj_remove_flag(_overlay, LV_OBJ_FLAG_HIDDEN);
+        else                                              lv_obj_add_flag(_overlay, LV_OBJ_FLAG_HIDDEN);
+    }
+}
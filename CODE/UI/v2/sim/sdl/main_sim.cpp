@@ -0,0 +1,54 @@
+// =============================================================================
+// MONOPOLY ELECTRONIC V2 — Desktop simulator entry point
+// =============================================================================
+// The game, storage and UI sources run unchanged; sim/ provides the board:
+//   pio run -e sim -t execute                       (keys: see sim.h)
+//   MONO_NFC_SCRIPT=taps.txt pio run -e sim -t execute
+#include <Arduino.h>
+#include <lvgl.h>
+#include <time.h>
+#include "config.h"
+#include "hardware.h"
+#include "nfc_handler.h"
+#include "game_logic.h"
+#include "storage.h"
+#include "ui.h"
+#include "sim.h"
+
+int main(int argc, char** argv) {
+    Serial.println(F("\n=== Monopoly Electronic V2 (simulator) ==="));
+    randomSeed((unsigned long)time(nullptr));
+
+    nfc_init();
+    nfc_simLoadScript(argc > 1 ? argv[1] : getenv("MONO_NFC_SCRIPT"));
+    nfc_startTask();
+    hw_initPower();
+
+    hw_initDisplay();
+    hw_initTouch();
+    hw_initButtons();
+    hw_initAudio();
+    hw_lvgl_init();
+
+    storage_loadSettings(G.settings);
+    hw_setVolume(G.settings.volume);
+
+    game_init();
+    G.phase = PHASE_SPLASH;
+
+    ui_init();
+    hw_playJingle();
+    Serial.println(F("[INIT] Ready"));
+
+    // Same loop as the render task; card jobs run here instead of a task
+    for (;;) {
+        uint32_t now = millis();
+        hw_simTick();
+        nfc_simTick(now);
+        hw_updatePower();
+        ui_update();
+        uint32_t idle = lv_timer_handler();
+        if (idle > SIM_LOOP_IDLE_MS) idle = SIM_LOOP_IDLE_MS;
+        delay(idle ? idle : 1);
+    }
+}
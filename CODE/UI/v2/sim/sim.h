@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+
+// =============================================================================
+// SIMULATOR HOOKS  (sim/ stands in for hardware.cpp, nfc_handler.cpp, main.cpp)
+// =============================================================================
+// sim/*.cpp is shared; sim/sdl/ is the interactive window, sim/bench/ the
+// headless screen benchmark and its display, sim/test/ headless checks (one
+// env and one main() each).
+//
+// Window keys: Left / A, Down / Space / Enter, Right / D are the three buttons;
+// 1-8 lay player cards 1-8 on the reader, 9 and 0 blank cards 9 and 10;
+// P toggles the frame-time overlay. The mouse is the touch panel.
+
+#define SIM_NFC_CARDS    10     // virtual cards, numbered from 1
+#define SIM_NFC_TAP_MS   400    // a tapped card stays on the reader this long
+#define SIM_ZOOM         2      // window pixels per panel pixel
+#define SIM_LOOP_IDLE_MS 10     // longest loop sleep: SDL events are polled
+
+// Virtual NFC reader. Scripts are text, one command per line ('#' comments):
+//   card <n> player <id> <rgb565 hex> <name>    define card n as a player card
+//   card <n> blank                              wipe card n
+//   <ms> tap <n>                                lay card n on the reader at <ms>
+void nfc_simTap(uint8_t card);
+bool nfc_simLoadScript(const char* path);
+void nfc_simTick(uint32_t now);         // scripted taps + the posted job
+
+void hw_simTick();                      // window: card keys, overlay toggle
+
+// Clock: millis() follows the wall clock unless a harness takes it over;
+// micros() always does, so measured times stay real
+void sim_virtualClock();                // millis() and the LVGL tick stop
+void sim_advance(uint32_t ms);          // move the virtual clock on
+
+// Headless display (sim/bench/): pixels sent through the flush callback
+uint64_t hw_simFlushedPixels();
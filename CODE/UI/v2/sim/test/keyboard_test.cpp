@@ -0,0 +1,198 @@
+// =============================================================================
+// MONOPOLY ELECTRONIC V2 — On-screen keyboard test (headless)
+// =============================================================================
+// Opens ui_keyboardAsync from a button's CLICKED callback, the way a screen
+// does, then drives the keyboard with a scripted keypad: type and confirm,
+// then open it again and close it. Checks what the done callback gets, and
+// that ui_update() and lv_timer_handler() keep running while it is open.
+//   pio run -e kb_test -t execute           -> exit code 0 = pass
+#include <Arduino.h>
+#include <lvgl.h>
+#include "config.h"
+#include "hardware.h"
+#include "nfc_handler.h"
+#include "game_logic.h"
+#include "ui.h"
+#include "sim.h"
+
+#define KB_TEST_FRAME_MS  LV_DEF_REFR_PERIOD   // one keypad read per step
+#define KB_TEST_MAX_STEPS 400
+
+static int _failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { Serial.printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); _failures++; } \
+} while (0)
+
+// =============================================================================
+// SCRIPTED KEYPAD  (one press, then one release, per queued key)
+// =============================================================================
+static uint32_t    _keys[64];
+static uint8_t     _keyHead = 0, _keyTail = 0;
+static bool        _keyDown = false;
+static uint32_t    _key     = 0;
+static lv_indev_t* _keypad  = nullptr;
+
+static void _keypadRead(lv_indev_t*, lv_indev_data_t* data) {
+    if (!_keyDown && _keyHead != _keyTail) {
+        _key     = _keys[_keyHead++ % 64];
+        _keyDown = true;
+    } else {
+        _keyDown = false;
+    }
+    data->key   = _key;
+    data->state = _keyDown ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static void _press(uint32_t key) {
+    _keys[_keyTail++ % 64] = key;
+}
+
+// =============================================================================
+// RENDER LOOP  (main.cpp's, on the virtual clock)
+// =============================================================================
+static uint32_t _ticks   = 0;       // heartbeat lv_timer
+static uint32_t _updates = 0;
+
+static void _step() {
+    sim_advance(KB_TEST_FRAME_MS);
+    ui_update();
+    _updates++;
+    lv_timer_handler();
+}
+
+// Until every queued key is pressed and released
+static void _drain() {
+    for (int i = 0; i < KB_TEST_MAX_STEPS && (_keyHead != _keyTail || _keyDown); i++) _step();
+    _step();                        // deletes queued by the last key
+}
+
+// =============================================================================
+// KEYBOARD
+// =============================================================================
+struct KbResult {
+    uint8_t calls;
+    bool    ok;
+    char    text[33];           // ui.cpp caps the keyboard at 32
+};
+static KbResult _result;
+static bool     _opened = false;
+
+static void _onDone(bool ok, const char* text, void* ctx) {
+    KbResult* r = (KbResult*)ctx;
+    r->calls++;
+    r->ok = ok;
+    strncpy(r->text, text, sizeof(r->text) - 1);
+    r->text[sizeof(r->text) - 1] = '\0';
+}
+
+static void _onOpenClicked(lv_event_t*) {
+    _opened = ui_keyboardAsync("", 12, "Name", _onDone, &_result);
+}
+
+static lv_obj_t* _openKeyboard() {
+    _opened = false;
+    _press(LV_KEY_ENTER);
+    _drain();
+    CHECK(_opened);
+    return lv_group_get_focused(lv_indev_get_group(_keypad));
+}
+
+// Button index with this label on the keyboard's current map
+static uint32_t _findKey(lv_obj_t* kb, const char* label) {
+    const char* const* map = lv_buttonmatrix_get_map(kb);
+    uint32_t id = 0;
+    for (uint32_t i = 0; map[i][0] != '\0'; i++) {
+        if (strcmp(map[i], "\n") == 0) continue;
+        if (strcmp(map[i], label) == 0) return id;
+        id++;
+    }
+    return LV_BUTTONMATRIX_BUTTON_NONE;
+}
+
+// Walks the selection to `label` with Left/Right, then presses Enter on it
+static void _tap(lv_obj_t* kb, const char* label) {
+    uint32_t target = _findKey(kb, label);
+    CHECK(target != LV_BUTTONMATRIX_BUTTON_NONE);
+    if (target == LV_BUTTONMATRIX_BUTTON_NONE) return;
+    for (int i = 0; i < 100 && lv_buttonmatrix_get_selected_button(kb) != target; i++) {
+        uint32_t sel = lv_buttonmatrix_get_selected_button(kb);
+        _press(sel == LV_BUTTONMATRIX_BUTTON_NONE || sel < target ? LV_KEY_RIGHT : LV_KEY_LEFT);
+        _drain();
+    }
+    CHECK(lv_buttonmatrix_get_selected_button(kb) == target);
+    _press(LV_KEY_ENTER);
+    _drain();
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+int main() {
+    sim_virtualClock();
+    nfc_init();
+    nfc_startTask();
+    hw_initPower();
+    hw_initDisplay();
+    hw_initTouch();
+    hw_initButtons();
+    hw_initAudio();
+    hw_lvgl_init();
+    hw_setVolume(0);
+
+    game_init();
+    game_setPhase(PHASE_MENU);
+    ui_init();
+
+    _keypad = lv_indev_create();
+    lv_indev_set_type(_keypad, LV_INDEV_TYPE_KEYPAD);
+    lv_indev_set_read_cb(_keypad, _keypadRead);
+
+    // The opener lives on the top layer so screen switches leave it alone
+    lv_group_t* openGroup = lv_group_create();
+    lv_obj_t*   opener    = lv_button_create(lv_layer_top());
+    lv_obj_add_event_cb(opener, _onOpenClicked, LV_EVENT_CLICKED, nullptr);
+    lv_group_add_obj(openGroup, opener);
+    lv_indev_set_group(_keypad, openGroup);
+    lv_timer_create([](lv_timer_t*) { _ticks++; }, KB_TEST_FRAME_MS, nullptr);
+    _step();
+
+    // --- Type and confirm ---
+    lv_obj_t* kb = _openKeyboard();
+    CHECK(kb != nullptr && lv_obj_check_type(kb, &lv_keyboard_class));
+    if (!kb) return 1;
+    CHECK(!ui_keyboardAsync("", 12, "Again", _onDone, &_result));   // one at a time
+
+    // The screen below keeps updating while the keyboard is up
+    uint32_t   ticks0 = _ticks, updates0 = _updates;
+    lv_obj_t*  scr0   = lv_screen_active();
+    game_setPhase(PHASE_SETTINGS);
+    for (int i = 0; i < 5; i++) _step();
+    CHECK(lv_screen_active() != scr0);
+    CHECK(_ticks > ticks0);
+    CHECK(_updates > updates0);
+    CHECK(_result.calls == 0);
+
+    _tap(kb, "h");
+    _tap(kb, "i");
+    _tap(kb, LV_SYMBOL_OK);
+    CHECK(_result.calls == 1);
+    CHECK(_result.ok);
+    CHECK(strcmp(_result.text, "hi") == 0);
+    CHECK(lv_indev_get_group(_keypad) == openGroup);   // focus handed back
+
+    // --- Open again and close ---
+    _result = KbResult{};
+    kb = _openKeyboard();
+    CHECK(kb != nullptr && lv_obj_check_type(kb, &lv_keyboard_class));
+    if (!kb) return 1;
+    _tap(kb, "x");
+    _tap(kb, LV_SYMBOL_KEYBOARD);
+    CHECK(_result.calls == 1);
+    CHECK(!_result.ok);
+    CHECK(lv_indev_get_group(_keypad) == openGroup);
+
+    Serial.printf("kb_test: %s (%d failures, %lu ui_update, %lu timer ticks)\n",
+                  _failures ? "FAIL" : "ok", _failures, (unsigned long)_updates, (unsigned long)_ticks);
+    return _failures ? 1 : 0;
+}
@@ -0,0 +1,199 @@
+// =============================================================================
+// MONOPOLY ELECTRONIC V2 — NFC result wake test (host)
+// =============================================================================
+// Runs src/nfc_handler.cpp's task on a host thread, with just enough of
+// FreeRTOS's task notifications and a PN532 that sees a card when told. The
+// main thread plays the render task on a screen with no LVGL timer: it posts
+// a read job and then waits for a notification with no deadline, as
+// hw_idle() does. Each card tapped while it waits must wake it within one
+// poll; a result nobody is told about fails the test at the watchdog.
+//   pio run -e nfc_wake_test -t execute      -> exit code 0 = pass
+#include <Arduino.h>
+#include "config.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using std::min;
+
+#define NFC_WAKE_TEST_TAPS     3
+#define NFC_WAKE_TEST_TAP_MS   150    // card laid down this long into the wait
+#define NFC_WAKE_TEST_HOLD_MS  (NFC_POLL_INTERVAL_MS + NFC_POLL_TIMEOUT_MS + 100)  // a poll sees it
+#define NFC_WAKE_TEST_SLACK_MS 50     // host scheduling, on top of one poll
+#define NFC_WAKE_TEST_LIMIT_MS 2000   // watchdog: the render task never woke
+
+// =============================================================================
+// FREERTOS  (task notifications only; one tick = 1 ms)
+// =============================================================================
+typedef int      BaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdTRUE           1
+#define pdPASS           1
+#define portMAX_DELAY    UINT32_MAX
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+struct _Task {
+    std::mutex              m;
+    std::condition_variable cv;
+    uint32_t                count = 0;
+};
+typedef _Task* TaskHandle_t;
+
+static thread_local _Task* _self = nullptr;
+
+static TaskHandle_t xTaskGetCurrentTaskHandle() {
+    if (!_self) _self = new _Task;
+    return _self;
+}
+
+static uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+    _Task* t = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lock(t->m);
+    auto given = [t] { return t->count > 0; };
+    if (ticks == portMAX_DELAY) t->cv.wait(lock, given);
+    else t->cv.wait_for(lock, std::chrono::milliseconds(ticks), given);
+    uint32_t n = t->count;
+    if (n) t->count = clear ? 0 : n - 1;
+    return n;
+}
+
+static void xTaskNotifyGive(TaskHandle_t t) {
+    std::lock_guard<std::mutex> lock(t->m);
+    t->count++;
+    t->cv.notify_one();
+}
+
+static BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t, void* arg,
+                                          uint32_t, TaskHandle_t* out, int) {
+    _Task* t = new _Task;
+    std::thread([=] { _self = t; fn(arg); }).detach();
+    if (out) *out = t;
+    return pdPASS;
+}
+
+// =============================================================================
+// PN532  (a player card on the reader between _tapAt and _liftAt)
+// =============================================================================
+#define PN532_MIFARE_ISO14443A 0x00
+
+struct TwoWire {
+    void begin(int, int) {}
+};
+static TwoWire Wire;
+
+static std::atomic<uint32_t> _tapAt{UINT32_MAX};
+static std::atomic<uint32_t> _liftAt{0};
+
+class Adafruit_PN532 {
+public:
+    Adafruit_PN532(int, int) {}
+    void     begin() {}
+    uint32_t getFirmwareVersion() { return 0x32010607; }
+    void     SAMConfig() {}
+
+    bool readPassiveTargetID(uint8_t, uint8_t* uid, uint8_t* uidLen, uint16_t timeoutMs) {
+        uint32_t until = millis() + timeoutMs;
+        do {
+            uint32_t now = millis();
+            if (now >= _tapAt.load() && now < _liftAt.load()) {
+                static const uint8_t kUid[4] = {0x5A, 0x1A, 0x00, 0x04};
+                memcpy(uid, kUid, sizeof(kUid));
+                *uidLen = sizeof(kUid);
+                return true;
+            }
+            delay(5);
+        } while ((int32_t)(until - millis()) > 0);
+        return false;
+    }
+
+    bool mifareclassic_AuthenticateBlock(uint8_t*, uint8_t, uint32_t, uint8_t, uint8_t*) { return true; }
+
+    bool mifareclassic_ReadDataBlock(uint8_t block, uint8_t* data) {
+        memset(data, 0, 16);
+        if (block == 4) {
+            data[0] = NFC_TYPE_PLAYER;
+            data[1] = 3;
+        } else {
+            strcpy((char*)data, "Dog");
+        }
+        return true;
+    }
+
+    bool mifareclassic_WriteDataBlock(uint8_t, uint8_t*) { return true; }
+};
+
+// The real NFC task, built against the stand-ins above
+#include "../../src/nfc_handler.cpp"
+
+// =============================================================================
+// RENDER TASK
+// =============================================================================
+static TaskHandle_t          _render = nullptr;
+static std::atomic<uint32_t> _wakes{0};
+
+static void _wake() {                   // hw_wake()
+    _wakes++;
+    xTaskNotifyGive(_render);
+}
+
+int main() {
+    _render = xTaskGetCurrentTaskHandle();
+    nfc_setWakeHook(_wake);
+    if (!nfc_init() || !nfc_startTask()) {
+        Serial.println("nfc_wake_test: task not started");
+        return 1;
+    }
+    uint8_t seq = nfc_post(NFC_JOB_READ_PLAYER);
+
+    std::atomic<bool> done{false};
+    std::thread([&] {
+        delay(NFC_WAKE_TEST_LIMIT_MS * NFC_WAKE_TEST_TAPS);
+        if (done) return;
+        Serial.printf("nfc_wake_test: FAIL, render task still asleep after %u ms\n",
+                      (unsigned)(NFC_WAKE_TEST_LIMIT_MS * NFC_WAKE_TEST_TAPS));
+        fflush(stdout);
+        _Exit(1);
+    }).detach();
+
+    int      failures = 0;
+    uint32_t worst    = 0;
+    for (uint8_t tap = 0; tap < NFC_WAKE_TEST_TAPS; tap++) {
+        uint32_t t0 = millis();
+        _tapAt  = t0 + NFC_WAKE_TEST_TAP_MS;
+        _liftAt = t0 + NFC_WAKE_TEST_TAP_MS + NFC_WAKE_TEST_HOLD_MS;
+
+        // No timer on this screen: nothing but a notification ends the wait
+        NfcResult r;
+        bool got = false;
+        while (!got) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            while (nfc_takeResult(r)) got = true;
+        }
+        uint32_t ms = millis() - _tapAt;
+        if (ms > worst) worst = ms;
+        bool ok = r.ok && r.seq == seq && r.player.playerId == 3 && strcmp(r.player.name, "Dog") == 0;
+        if (!ok || ms > NFC_POLL_INTERVAL_MS + NFC_POLL_TIMEOUT_MS + NFC_WAKE_TEST_SLACK_MS) {
+            Serial.printf("FAIL tap %u: ok %d seq %u/%u, %lu ms after the tap\n", tap, r.ok,
+                          r.seq, seq, (unsigned long)ms);
+            failures++;
+        }
+
+        // Card off the reader before the next tap; drop anything it still read
+        while ((int32_t)(millis() - _liftAt) < 0) delay(10);
+        delay(NFC_POLL_INTERVAL_MS + NFC_POLL_TIMEOUT_MS);
+        while (nfc_takeResult(r)) {}
+        ulTaskNotifyTake(pdTRUE, 0);
+    }
+    done = true;
+
+    Serial.printf("nfc_wake_test: %s (%u taps, worst %lu ms from tap to render task, %lu wakes)\n",
+                  failures ? "FAIL" : "ok", NFC_WAKE_TEST_TAPS, (unsigned long)worst,
+                  (unsigned long)_wakes.load());
+    fflush(stdout);
+    _Exit(failures ? 1 : 0);        // the NFC thread never returns
+}
@@ -0,0 +1,73 @@
+// =============================================================================
+// MONOPOLY ELECTRONIC V2 — SpscQueue two-thread test (host)
+// =============================================================================
+// One producer thread and one consumer thread hammer a small queue, as the
+// render and NFC tasks do on two cores. Every item carries its sequence
+// number several times over, so a slot read before its write is visible (or
+// while it is overwritten) shows up as a torn item; lost, duplicated or
+// reordered items show up as a sequence gap.
+//   pio run -e spsc_test -t execute          -> exit code 0 = pass
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include "spsc_queue.h"
+
+#define SPSC_TEST_ITEMS  1000000u
+
+struct Item {
+    uint32_t seq;
+    uint32_t inv;                   // ~seq
+    uint8_t  fill[24];              // seq's low byte, repeated
+};
+
+template <uint8_t N>
+static int _run() {
+    static SpscQueue<Item, N> q;
+    uint32_t torn = 0, gaps = 0, fullSpins = 0, emptySpins = 0;
+
+    std::thread producer([&] {
+        Item it;
+        for (uint32_t seq = 0; seq < SPSC_TEST_ITEMS; seq++) {
+            it.seq = seq;
+            it.inv = ~seq;
+            memset(it.fill, (uint8_t)seq, sizeof(it.fill));
+            while (!q.push(it)) {
+                fullSpins++;
+                std::this_thread::yield();  // one host core: let the consumer run
+            }
+        }
+    });
+
+    uint32_t expect = 0;
+    Item it;
+    while (expect < SPSC_TEST_ITEMS) {
+        if (!q.pop(it)) {
+            emptySpins++;
+            std::this_thread::yield();
+            continue;
+        }
+        bool ok = it.inv == ~it.seq;
+        for (uint8_t b : it.fill) ok = ok && b == (uint8_t)it.seq;
+        if (!ok) torn++;
+        if (it.seq != expect) gaps++;
+        expect = it.seq + 1;
+    }
+    producer.join();
+    bool empty = !q.pop(it);
+
+    printf("spsc_test N=%-3u %u items: %u torn, %u out of sequence, %s at the end "
+           "(%u full / %u empty spins)\n",
+           (unsigned)N, SPSC_TEST_ITEMS, torn, gaps, empty ? "empty" : "NOT empty",
+           fullSpins, emptySpins);
+    return torn || gaps || !empty;
+}
+
+int main() {
+    // The NFC rings are 4 deep; 1 and 128 are the edges of what N allows
+    int failed = 0;
+    failed += _run<1>();
+    failed += _run<4>();
+    failed += _run<128>();
+    printf("spsc_test: %s\n", failed ? "FAIL" : "ok");
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,107 @@
+// =============================================================================
+// MONOPOLY ELECTRONIC V2 — Game statistics test (host)
+// =============================================================================
+// The engine and game_stats.cpp without a screen: the cash ring keeps the
+// last STATS_CASH_SAMPLES turns, oldest first, and dice and card moves each
+// add one landing to the heat-map, whether or not the UI then resolves the
+// tile.
+//   pio run -e stats_test -t execute         -> exit code 0 = pass
+#include <Arduino.h>
+#include "config.h"
+#include "game_logic.h"
+#include "game_stats.h"
+
+#define STATS_TEST_EXTRA 5          // turns past a full ring
+
+static int _failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { Serial.printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); _failures++; } \
+} while (0)
+
+// =============================================================================
+// CASH RING
+// =============================================================================
+static void _cashRing() {
+    game_newGame(2);
+    const int32_t start = G.players[0].money;
+    CHECK(S.cashCount == 1);
+    CHECK(stats_cash(0, 0) == start);
+
+    // Player 1 gains 10 per turn: sample k (0 = opening balances) is start + 10k
+    const uint16_t turns = STATS_CASH_SAMPLES + STATS_TEST_EXTRA;
+    for (uint16_t t = 0; t < turns; t++) {
+        game_collectFromBank(0, 10);
+        game_endTurn();
+        if (t == STATS_CASH_SAMPLES - 2) {
+            CHECK(S.cashCount == STATS_CASH_SAMPLES);      // full, nothing dropped yet
+            CHECK(S.cashDropped == 0);
+            CHECK(stats_cash(0, 0) == start);
+        }
+    }
+    const uint16_t dropped = turns + 1 - STATS_CASH_SAMPLES;
+    CHECK(S.cashCount == STATS_CASH_SAMPLES);
+    CHECK(S.cashDropped == dropped);
+    for (uint8_t i = 0; i < S.cashCount; i++) {
+        CHECK(stats_cash(0, i) == start + 10 * (int32_t)(dropped + i));
+        CHECK(stats_cash(1, i) == start);
+    }
+    CHECK(stats_cash(0, S.cashCount - 1) == G.players[0].money);
+}
+
+// =============================================================================
+// LANDINGS
+// =============================================================================
+static uint16_t _landed(uint8_t tile) {
+    return S.landings[0][tile];
+}
+
+static void _card(CardEffect effect, int16_t value, bool uiResolves) {
+    const CardData card = {"test", effect, value, 0};
+    game_applyCard(card);
+    if (uiResolves) game_resolveTile();     // what _evCardOk() does for a property
+}
+
+static void _landings() {
+    game_newGame(2);
+
+    // Dice: 3 + 4 from GO to Chance, then the tile is resolved
+    G.dice1 = 3;
+    G.dice2 = 4;
+    game_movePlayer();
+    game_resolveTile();
+    CHECK(G.players[0].position == 7);
+    CHECK(_landed(7) == 1);
+
+    // Back 3 to Income Tax: the UI ends the turn without resolving
+    _card(CARD_MOVEREL, -3, false);
+    CHECK(G.players[0].position == 4);
+    CHECK(_landed(4) == 1);
+
+    // Advance to Illinois Ave., which the UI resolves
+    _card(CARD_MOVETO, 24, true);
+    CHECK(_landed(24) == 1);
+
+    // Nearest railroad and utility from there
+    _card(CARD_NEAREST_RR, 0, true);
+    CHECK(G.players[0].position == 25);
+    CHECK(_landed(25) == 1);
+    _card(CARD_NEAREST_UTIL, 0, true);
+    CHECK(G.players[0].position == 28);
+    CHECK(_landed(28) == 1);
+
+    // Money cards move nobody
+    _card(CARD_COLLECT, 50, false);
+    CHECK(_landed(28) == 1);
+
+    uint32_t total = 0;
+    for (uint8_t t = 0; t < BOARD_SIZE; t++) total += _landed(t);
+    CHECK(total == 5);
+}
+
+int main() {
+    _cashRing();
+    _landings();
+    Serial.printf("stats_test: %s (%d failures)\n", _failures ? "FAIL" : "ok", _failures);
+    return _failures ? 1 : 0;
+}
@@ -0,0 +1,92 @@
+#include "boot_trace.h"
+
+struct _BootStage {
+    const char* name;
+    uint32_t    us;        // micros() since reset
+    uint8_t     core;
+};
+
+static _BootStage   _stages[BOOT_MAX_STAGES];
+static uint8_t      _count    = 0;
+static volatile uint8_t _pending = 0;             // spawned tasks still running
+static bool         _reported = false;
+static portMUX_TYPE _lock     = portMUX_INITIALIZER_UNLOCKED;
+
+struct _BootTask {
+    const char* name;
+    void      (*fn)();
+};
+static _BootTask _tasks[4];
+static uint8_t   _taskCount = 0;
+
+// =============================================================================
+// TIMELINE
+// =============================================================================
+void boot_mark(const char* stage) {
+    portENTER_CRITICAL(&_lock);
+    if (_count < BOOT_MAX_STAGES) _stages[_count++] = {stage, (uint32_t)micros(), (uint8_t)xPortGetCoreID()};
+    portEXIT_CRITICAL(&_lock);
+}
+
+// =============================================================================
+// BACKGROUND BRING-UP
+// =============================================================================
+static void _bootTask(void* arg) {
+    _BootTask* t = (_BootTask*)arg;
+    t->fn();
+    boot_mark(t->name);
+    portENTER_CRITICAL(&_lock);
+    _pending--;
+    portEXIT_CRITICAL(&_lock);
+    vTaskDelete(nullptr);
+}
+
+void boot_spawn(const char* name, void (*fn)()) {
+    if (_taskCount == sizeof(_tasks) / sizeof(_tasks[0])) {
+        // Out of slots: run it here, still traced
+        fn();
+        boot_mark(name);
+        return;
+    }
+    _BootTask* t = &_tasks[_taskCount++];
+    *t = {name, fn};
+    portENTER_CRITICAL(&_lock);
+    _pending++;
+    portEXIT_CRITICAL(&_lock);
+    // Core 0: the Arduino loop (display, LVGL) runs on core 1
+    if (xTaskCreatePinnedToCore(_bootTask, name, 4096, t, 1, nullptr, 0) != pdPASS) {
+        portENTER_CRITICAL(&_lock);
+        _pending--;
+        portEXIT_CRITICAL(&_lock);
+        fn();
+        boot_mark(name);
+    }
+}
+
+bool boot_done() { return _pending == 0; }
+
+// =============================================================================
+// REPORT
+// =============================================================================
+void boot_report() {
+    if (_reported || !boot_done()) return;
+    _reported = true;
+
+    uint32_t prev = 0;
+    uint32_t total = 0;
+    Serial.println(F("[BOOT] timeline (ms since reset, +delta, core)"));
+    for (uint8_t i = 0; i < _count; i++) {
+        const _BootStage& s = _stages[i];
+        // Marks are in time order across both cores
+        uint32_t ms = s.us / 1000;
+        Serial.printf("[BOOT] %6lu  +%5lu  c%u  %s\n", (unsigned long)ms,
+                      (unsigned long)(ms - prev), s.core, s.name);
+        prev = ms;
+        if (ms > total) total = ms;
+    }
+    if (total > BOOT_BUDGET_MS) {
+        Serial.printf("[BOOT] over budget: %lu ms > %u ms\n", (unsigned long)total, BOOT_BUDGET_MS);
+    } else {
+        Serial.printf("[BOOT] %lu ms (budget %u ms)\n", (unsigned long)total, BOOT_BUDGET_MS);
+    }
+}
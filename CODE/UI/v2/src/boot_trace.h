@@ -0,0 +1,21 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// =============================================================================
+// BOOT TRACE  (per-stage timeline + background bring-up)
+// =============================================================================
+// setup() marks each stage as it finishes; slow peripherals are handed to
+// boot_spawn() so they come up on core 0 while the display and LVGL start on
+// the loop core. boot_report() prints the timeline once every spawned task has
+// finished and warns when boot took longer than BOOT_BUDGET_MS.
+
+#ifndef BOOT_BUDGET_MS
+  #define BOOT_BUDGET_MS     1500
+#endif
+#define BOOT_MAX_STAGES      16
+
+void boot_mark(const char* stage);                 // stage finished now (any task)
+void boot_spawn(const char* name, void (*fn)());   // run fn in the background
+bool boot_done();                                  // all spawned tasks finished
+void boot_report();                                // once, after boot_done()
@@ -0,0 +1,331 @@
+#include "game_batch.h"
+#include "game_stats.h"
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+// xorshift32 per lane; both dice come from one draw (high / low half-words
+// scaled into 0..5 with a multiply, no division).
+static inline uint32_t _xorshift(uint32_t x) {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+static inline uint8_t _dieHi(uint32_t r) { return 1 + (uint8_t)(((r >> 16) * 6) >> 16); }
+static inline uint8_t _dieLo(uint32_t r) { return 1 + (uint8_t)(((r & 0xFFFF) * 6) >> 16); }
+
+static void _bankruptLane(BatchState& B, uint8_t p, uint16_t g) {
+    B.alive[p][g] = 0;
+    B.alivePlayers[g]--;
+    for (uint8_t t = 0; t < BOARD_SIZE; t++) {
+        if (B.owner[t][g] == (int8_t)p) {
+            B.owner[t][g] = -1;
+            B.houses[t][g] = 0;
+            B.mortgaged[t][g] = 0;
+        }
+    }
+    for (uint8_t grp = 0; grp < NUM_GROUPS; grp++) B.groupOwned[p][grp][g] = 0;
+}
+
+// Same result as game_calcRent() for lane g
+static int32_t _laneRent(const BatchState& B, uint8_t tile, uint16_t g, uint8_t diceTotal) {
+    const TileData& td = TILES[tile];
+    int8_t o = B.owner[tile][g];
+    if (o < 0 || B.mortgaged[tile][g]) return 0;
+    uint8_t count = B.groupOwned[o][td.group][g];
+
+    if (td.type == TILE_RAILROAD) return count ? td.rent[count - 1] : 0;
+    if (td.type == TILE_UTILITY)  return (count >= 2) ? diceTotal * 10 : diceTotal * 4;
+
+    uint8_t h = B.houses[tile][g];
+    if (h > 0) return td.rent[h];
+    int32_t base = td.rent[0];
+    if (count >= GROUP_SIZE[td.group]) base *= 2;
+    return base;
+}
+
+// =============================================================================
+// INIT / STEP
+// =============================================================================
+void batch_init(BatchState& B, uint8_t numPlayers, uint32_t seed) {
+    memset(&B, 0, sizeof(B));
+    memset(B.owner, -1, sizeof(B.owner));
+    B.numPlayers = numPlayers;
+    for (uint8_t p = 0; p < numPlayers; p++) {
+        for (uint16_t g = 0; g < BATCH_GAMES; g++) {
+            B.money[p][g] = G.settings.startingMoney;
+            B.alive[p][g] = 1;
+        }
+    }
+    for (uint16_t g = 0; g < BATCH_GAMES; g++) {
+        B.alivePlayers[g] = numPlayers;
+        B.rng[g] = (seed + g) ? (seed + g) : 0x9E3779B9u;   // xorshift must not be 0
+    }
+}
+
+template <class R>
+static void _step(BatchState& B) {
+    const uint8_t p = B.step % B.numPlayers;
+    uint8_t act[BATCH_GAMES];
+
+    // --- Dice (all lanes, every step, so replay stays in sync) -------------
+    for (uint16_t g = 0; g < BATCH_GAMES; g++) {
+        uint32_t r = _xorshift(B.rng[g]);
+        B.rng[g]   = r;
+        B.dice1[g] = _dieHi(r);
+        B.dice2[g] = _dieLo(r);
+    }
+
+    // --- Active mask --------------------------------------------------------
+    for (uint16_t g = 0; g < BATCH_GAMES; g++) {
+        act[g] = B.alive[p][g] & (uint8_t)(B.alivePlayers[g] > 1);
+    }
+
+    // --- Jail roll (matches game_resolveJailRoll) ---------------------------
+    // Doubles free the player; otherwise the fine is forced on the last turn.
+    for (uint16_t g = 0; g < BATCH_GAMES; g++) {
+        uint8_t jailed  = act[g] & B.inJail[p][g];
+        uint8_t turns   = B.jailTurns[p][g] + 1;
+        uint8_t doubles = (B.dice1[g] == B.dice2[g]);
+        uint8_t forced  = jailed & !doubles & (turns >= R::jailMaxTurns());
+        uint8_t stay    = jailed & !doubles & !forced;
+
+        B.money[p][g]        -= JAIL_FINE * forced;
+        B.freeParkingPool[g] += JAIL_FINE * forced * R::freeParkingPool();
+        B.inJail[p][g]        = jailed ? stay : B.inJail[p][g];
+        B.jailTurns[p][g]     = stay ? turns : (jailed ? 0 : B.jailTurns[p][g]);
+        act[g]               &= !stay;
+    }
+    for (uint16_t g = 0; g < BATCH_GAMES; g++) {
+        if (act[g] && B.money[p][g] < 0) { _bankruptLane(B, p, g); act[g] = 0; }
+    }
+
+    // --- Movement + GO salary (branch-free) --------------------------------
+    for (uint16_t g = 0; g < BATCH_GAMES; g++) {
+        uint8_t np   = B.position[p][g] + B.dice1[g] + B.dice2[g];
+        uint8_t wrap = (np >= BOARD_SIZE);
+        np -= wrap * BOARD_SIZE;
+        B.position[p][g] = act[g] ? np : B.position[p][g];
+        B.money[p][g]   += GO_SALARY * (wrap & act[g]);
+    }
+
+    // --- Tile resolution (gathers on owner / houses rows) ------------------
+    for (uint16_t g = 0; g < BATCH_GAMES; g++) {
+        if (!act[g]) continue;
+        const uint8_t  tile = B.position[p][g];
+        const TileData& td  = TILES[tile];
+
+        switch (td.type) {
+            case TILE_PROPERTY:
+            case TILE_RAILROAD:
+            case TILE_UTILITY: {
+                int8_t o = B.owner[tile][g];
+                if (o == -1) {
+                    if (B.money[p][g] >= td.price) {
+                        B.money[p][g] -= td.price;
+                        B.owner[tile][g] = p;
+                        B.groupOwned[p][td.group][g]++;
+                    }
+                } else if (o != (int8_t)p) {
+                    int32_t rent = _laneRent(B, tile, g, B.dice1[g] + B.dice2[g]);
+                    if (rent > 0) {
+                        B.money[p][g] -= rent;
+                        B.money[o][g] += rent;
+                        if (B.money[p][g] < 0) _bankruptLane(B, p, g);
+                    }
+                }
+                break;
+            }
+            case TILE_TAX:
+                B.money[p][g] -= td.price;
+                B.freeParkingPool[g] += td.price * R::freeParkingPool();
+                if (B.money[p][g] < 0) _bankruptLane(B, p, g);
+                break;
+
+            case TILE_FREE_PARKING:
+                if (R::freeParkingPool()) {
+                    B.money[p][g] += B.freeParkingPool[g];
+                    B.freeParkingPool[g] = 0;
+                }
+                break;
+
+            case TILE_GO_TO_JAIL:
+                B.position[p][g]  = JAIL_POSITION;
+                B.inJail[p][g]    = 1;
+                B.jailTurns[p][g] = 0;
+                break;
+
+            default:
+                break;
+        }
+    }
+    B.step++;
+}
+
+typedef void (*BatchStepFn)(BatchState&);
+
+static const BatchStepFn STEP_TABLE[2][MAX_JAIL_TURNS] = {
+    { &_step<Rules<false, 1>>, &_step<Rules<false, 2>>, &_step<Rules<false, 3>>, &_step<Rules<false, 4>>, &_step<Rules<false, 5>> },
+    { &_step<Rules<true,  1>>, &_step<Rules<true,  2>>, &_step<Rules<true,  3>>, &_step<Rules<true,  4>>, &_step<Rules<true,  5>> },
+};
+
+static BatchStepFn _stepFor(const GameSettings& s) {
+    uint8_t jt = s.jailMaxTurns;
+    if (jt < 1) jt = 1;
+    if (jt > MAX_JAIL_TURNS) jt = MAX_JAIL_TURNS;
+    return STEP_TABLE[s.freeParkingPool ? 1 : 0][jt - 1];
+}
+
+void batch_step(BatchState& B) {
+    _stepFor(G.settings)(B);
+}
+
+void batch_stepRuntime(BatchState& B) {
+    _step<RuntimeRules>(B);
+}
+
+uint16_t batch_activeGames(const BatchState& B) {
+    uint16_t n = 0;
+    for (uint16_t g = 0; g < BATCH_GAMES; g++) n += (B.alivePlayers[g] > 1);
+    return n;
+}
+
+void batch_loadLane(const BatchState& B, uint16_t lane) {
+    G.numPlayers      = B.numPlayers;
+    G.alivePlayers    = B.alivePlayers[lane];
+    G.freeParkingPool = B.freeParkingPool[lane];
+    for (uint8_t p = 0; p < MAX_PLAYERS; p++) {
+        Player& pl = G.players[p];
+        pl.position   = B.position[p][lane];
+        pl.money      = B.money[p][lane];
+        pl.alive      = B.alive[p][lane];
+        pl.inJail     = B.inJail[p][lane];
+        pl.jailTurns  = B.jailTurns[p][lane];
+        pl.ownedTiles = 0;
+    }
+    for (uint8_t t = 0; t < BOARD_SIZE; t++) {
+        G.props[t].owner     = B.owner[t][lane];
+        G.props[t].houses    = B.houses[t][lane];
+        G.props[t].mortgaged = B.mortgaged[t][lane];
+        if (B.owner[t][lane] >= 0) G.players[B.owner[t][lane]].ownedTiles |= (1ULL << t);
+    }
+    game_rehash();
+    game_recomputeStandings();
+}
+
+// =============================================================================
+// SCALAR REFERENCE  (the same turn, played through the game_* API on G)
+// =============================================================================
+static void _scalarTurn(uint8_t p, uint8_t d1, uint8_t d2) {
+    Player& pl = G.players[p];
+    if (!pl.alive || G.alivePlayers <= 1) return;
+    game_setCurrentPlayer(p);
+
+    G.dice1 = d1;
+    G.dice2 = d2;
+    G.isDoubles = (d1 == d2);
+    if (pl.inJail) {
+        game_resolveJailRoll(p);
+        if (pl.inJail || !pl.alive) return;
+    }
+
+    pl.doublesCount = 0;
+    game_movePlayer();
+    game_resolveTile();
+
+    switch (G.tileAction) {
+        case ACT_BUY:          game_buyProperty(p, pl.position); break;
+        case ACT_PAY_RENT:     game_payRent(p, pl.position); break;
+        case ACT_TAX:          game_payBank(p, TILES[pl.position].price); break;
+        case ACT_FREE_PARKING:
+            if (G.settings.freeParkingPool) game_collectFreeParking(p);
+            break;
+        default: break;
+    }
+}
+
+static bool _laneMatches(const BatchState& B, uint16_t g) {
+    if (G.alivePlayers != B.alivePlayers[g]) return false;
+    if (G.freeParkingPool != B.freeParkingPool[g]) return false;
+    for (uint8_t p = 0; p < B.numPlayers; p++) {
+        const Player& pl = G.players[p];
+        if (pl.position != B.position[p][g] || pl.money != B.money[p][g]) return false;
+        if (pl.alive != (bool)B.alive[p][g] || pl.inJail != (bool)B.inJail[p][g]) return false;
+        if (pl.jailTurns != B.jailTurns[p][g]) return false;
+    }
+    for (uint8_t t = 0; t < BOARD_SIZE; t++) {
+        if (G.props[t].owner != B.owner[t][g]) return false;
+        if (G.props[t].houses != B.houses[t][g]) return false;
+        if (G.props[t].mortgaged != (bool)B.mortgaged[t][g]) return false;
+    }
+    return true;
+}
+
+// Batch state is ~20 KB; keep it off the loop task stack
+static BatchState _bench;
+static GameState  _savedG;
+static GameStats  _savedS;
+
+bool batch_verify(uint8_t numPlayers, uint16_t steps, uint32_t seed) {
+    _savedG = G;
+    _savedS = S;
+    batch_init(_bench, numPlayers, seed);
+    for (uint16_t s = 0; s < steps; s++) batch_step(_bench);
+
+    bool ok = true;
+    for (uint16_t g = 0; g < BATCH_GAMES && ok; g++) {
+        game_newGame(numPlayers);
+        uint32_t rng = (seed + g) ? (seed + g) : 0x9E3779B9u;
+        for (uint16_t s = 0; s < steps; s++) {
+            rng = _xorshift(rng);
+            _scalarTurn(s % numPlayers, _dieHi(rng), _dieLo(rng));
+        }
+        if (!_laneMatches(_bench, g)) {
+            Serial.printf("[BATCH] lane %u diverges from scalar after %u steps\n", g, steps);
+            ok = false;
+        }
+    }
+    G = _savedG;
+    S = _savedS;
+    if (ok) Serial.printf("[BATCH] %u lanes x %u steps bit-exact\n", BATCH_GAMES, steps);
+    return ok;
+}
+
+void batch_benchmark(uint8_t numPlayers, uint16_t steps) {
+    _savedG = G;
+    _savedS = S;
+
+    uint32_t t0 = micros();
+    batch_init(_bench, numPlayers, 1);
+    for (uint16_t s = 0; s < steps; s++) batch_step(_bench);
+    uint32_t policyUs = micros() - t0;
+
+    t0 = micros();
+    batch_init(_bench, numPlayers, 1);
+    for (uint16_t s = 0; s < steps; s++) batch_stepRuntime(_bench);
+    uint32_t runtimeUs = micros() - t0;
+
+    t0 = micros();
+    for (uint16_t g = 0; g < BATCH_GAMES; g++) {
+        game_newGame(numPlayers);
+        uint32_t rng = 1 + g;
+        for (uint16_t s = 0; s < steps; s++) {
+            rng = _xorshift(rng);
+            _scalarTurn(s % numPlayers, _dieHi(rng), _dieLo(rng));
+        }
+    }
+    uint32_t scalarUs = micros() - t0;
+
+    G = _savedG;
+    S = _savedS;
+    Serial.printf("[BATCH] %u games x %u steps (pool=%d jail=%d)\n", BATCH_GAMES, steps,
+                  G.settings.freeParkingPool, G.settings.jailMaxTurns);
+    Serial.printf("[BATCH]   policy  %.1f games/s (%lu us)\n",
+                  BATCH_GAMES * 1e6f / (policyUs ? policyUs : 1), (unsigned long)policyUs);
+    Serial.printf("[BATCH]   runtime %.1f games/s (%lu us)\n",
+                  BATCH_GAMES * 1e6f / (runtimeUs ? runtimeUs : 1), (unsigned long)runtimeUs);
+    Serial.printf("[BATCH]   scalar  %.1f games/s (%lu us)\n",
+                  BATCH_GAMES * 1e6f / (scalarUs ? scalarUs : 1), (unsigned long)scalarUs);
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+#include "game_logic.h"
+
+// =============================================================================
+// BATCH ENGINE  (structure-of-arrays simulation of many games in lock-step)
+// =============================================================================
+// Every row below holds one value per game ("lane"), so the per-step work for
+// dice, movement and GO salary is a straight loop over contiguous arrays that
+// the compiler can vectorise. All lanes advance the same player index per
+// step (player = step % numPlayers); dead players simply sit their turn out.
+//
+// Modelled rules: dice, movement, GO salary, buy-if-affordable, rent (houses,
+// monopoly doubling, railroads, utilities), tax, free parking pool, go-to-jail
+// and bankruptcy. Jailed players roll for doubles and pay the fine after
+// jailMaxTurns failed rolls. Doubles do not grant an extra roll and cards are
+// not applied.
+//
+// The step is templated on the rule policies from game_logic.h: batch_step()
+// runs the instantiation matching G.settings, batch_stepRuntime() the one that
+// reads G.settings on every use.
+
+#ifndef BATCH_GAMES
+  #define BATCH_GAMES 64
+#endif
+
+struct BatchState {
+    // Per-player rows
+    uint8_t  position[MAX_PLAYERS][BATCH_GAMES];
+    int32_t  money[MAX_PLAYERS][BATCH_GAMES];
+    uint8_t  alive[MAX_PLAYERS][BATCH_GAMES];          // 0 / 1
+    uint8_t  inJail[MAX_PLAYERS][BATCH_GAMES];         // 0 / 1
+    uint8_t  jailTurns[MAX_PLAYERS][BATCH_GAMES];
+
+    // Per-tile rows
+    int8_t   owner[BOARD_SIZE][BATCH_GAMES];           // -1 = bank
+    uint8_t  houses[BOARD_SIZE][BATCH_GAMES];
+    uint8_t  mortgaged[BOARD_SIZE][BATCH_GAMES];
+
+    // Owned-tile count per player and colour group (monopoly / RR / utility)
+    uint8_t  groupOwned[MAX_PLAYERS][NUM_GROUPS][BATCH_GAMES];
+
+    // Per-game scalars
+    int32_t  freeParkingPool[BATCH_GAMES];
+    uint8_t  alivePlayers[BATCH_GAMES];
+    uint8_t  dice1[BATCH_GAMES];
+    uint8_t  dice2[BATCH_GAMES];
+    uint32_t rng[BATCH_GAMES];                         // xorshift32 state
+
+    uint8_t  numPlayers;
+    uint16_t step;
+};
+
+// Reset all lanes to a fresh game. Lane g seeds its dice RNG from seed + g.
+void batch_init(BatchState& B, uint8_t numPlayers, uint32_t seed);
+
+// One lock-step turn across every lane (rolls dice, then plays the turn)
+void batch_step(BatchState& B);          // Rules<> picked from G.settings
+void batch_stepRuntime(BatchState& B);   // RuntimeRules (flag checks)
+
+// Number of lanes whose game is still running
+uint16_t batch_activeGames(const BatchState& B);
+
+// Copy one lane into the scalar GameState G (players, board, pool)
+void batch_loadLane(const BatchState& B, uint16_t lane);
+
+// Replay every lane through the scalar game_* functions and compare the
+// result bit-for-bit. Clobbers and then restores G. Returns true on match.
+bool batch_verify(uint8_t numPlayers, uint16_t steps, uint32_t seed);
+
+// Print games/sec of the policy and runtime-flag batch steps and of the
+// scalar game_* path to Serial
+void batch_benchmark(uint8_t numPlayers, uint16_t steps);
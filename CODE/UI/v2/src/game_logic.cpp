@@ -1,4 +1,5 @@
 #include "game_logic.h"
+#include "game_stats.h"
 
 GameState G;
 
@@ -12,15 +13,276 @@ static void _shuffleArray(uint8_t* arr, uint8_t len) {
     }
 }
 
+// =============================================================================
+// STATE HASH  (Zobrist)
+// =============================================================================
+// Keys are derived from a feature id with splitmix64 instead of being stored
+// in tables, so money buckets need no upper bound and cost no RAM.
+enum HashFeature : uint8_t {
+    HF_POSITION = 1, HF_MONEY, HF_ALIVE, HF_JAIL, HF_JAIL_CARD,
+    HF_OWNER, HF_HOUSES, HF_MORTGAGED,
+    HF_CHANCE_IDX, HF_COMMUNITY_IDX, HF_CURRENT, HF_POOL,
+};
+
+static inline uint64_t _zkey(HashFeature f, uint8_t slot, int32_t value) {
+    uint64_t z = ((uint64_t)f << 56) ^ ((uint64_t)slot << 40) ^ (uint32_t)value;
+    z += 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static inline int32_t _bucket(int32_t money) {
+    // Floor division so -1 and +1 land in different buckets
+    return (money >= 0) ? money / ZOBRIST_MONEY_BUCKET
+                        : -((-money + ZOBRIST_MONEY_BUCKET - 1) / ZOBRIST_MONEY_BUCKET);
+}
+
+uint64_t game_computeHash() {
+    uint64_t h = 0;
+    for (uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        const Player& p = G.players[i];
+        h ^= _zkey(HF_POSITION, i, p.position);
+        h ^= _zkey(HF_MONEY, i, _bucket(p.money));
+        if (p.alive)       h ^= _zkey(HF_ALIVE, i, 0);
+        if (p.inJail)      h ^= _zkey(HF_JAIL, i, p.jailTurns);
+        if (p.hasJailCard) h ^= _zkey(HF_JAIL_CARD, i, 0);
+    }
+    for (uint8_t t = 0; t < BOARD_SIZE; t++) {
+        const PropertyState& ps = G.props[t];
+        if (ps.owner >= 0) h ^= _zkey(HF_OWNER, t, ps.owner);
+        if (ps.houses)     h ^= _zkey(HF_HOUSES, t, ps.houses);
+        if (ps.mortgaged)  h ^= _zkey(HF_MORTGAGED, t, 0);
+    }
+    h ^= _zkey(HF_CHANCE_IDX, 0, G.chanceIdx);
+    h ^= _zkey(HF_COMMUNITY_IDX, 0, G.communityIdx);
+    h ^= _zkey(HF_CURRENT, 0, G.currentPlayer);
+    h ^= _zkey(HF_POOL, 0, _bucket(G.freeParkingPool));
+    return h;
+}
+
+void game_rehash() {
+    G.hash = game_computeHash();
+}
+
+#if ZOBRIST_VERIFY
+static void _hashCheck(const char* where) {
+    uint64_t full = game_computeHash();
+    if (full != G.hash) {
+        Serial.printf("[HASH] mismatch after %s: inc=%016llx full=%016llx\n",
+                      where, (unsigned long long)G.hash, (unsigned long long)full);
+        G.hash = full;
+    }
+}
+  #define HASH_CHECK()  _hashCheck(__func__)
+#else
+  #define HASH_CHECK()  ((void)0)
+#endif
+
+// =============================================================================
+// STANDINGS
+// =============================================================================
+// A mortgaged tile is worth its price less the loan and raises nothing more;
+// an unmortgaged one is worth price + buildings and raises its mortgage value
+// plus half the building cost (bank buy-back).
+static inline int32_t _tileWorth(uint8_t tile) {
+    const TileData& td = TILES[tile];
+    const PropertyState& ps = G.props[tile];
+    return ps.mortgaged ? td.price - td.mortgage : td.price + ps.houses * td.houseCost;
+}
+
+static inline int32_t _tileLiquidation(uint8_t tile) {
+    const TileData& td = TILES[tile];
+    const PropertyState& ps = G.props[tile];
+    return ps.mortgaged ? 0 : td.mortgage + ps.houses * (td.houseCost / 2);
+}
+
+// Is player a ahead of player b? Bankrupt players always trail.
+static inline bool _ahead(uint8_t a, uint8_t b) {
+    if (G.players[a].alive != G.players[b].alive) return G.players[a].alive;
+    if (G.netWorth[a] != G.netWorth[b]) return G.netWorth[a] > G.netWorth[b];
+    return a < b;
+}
+
+// Move one player to its place in rankOrder (only its own value changed)
+static void _rerank(uint8_t idx) {
+    if (idx >= G.numPlayers) return;
+    uint8_t r = G.rank[idx];
+    while (r > 0 && _ahead(idx, G.rankOrder[r - 1])) {
+        G.rankOrder[r] = G.rankOrder[r - 1];
+        G.rank[G.rankOrder[r]] = r;
+        r--;
+    }
+    while (r + 1 < G.numPlayers && _ahead(G.rankOrder[r + 1], idx)) {
+        G.rankOrder[r] = G.rankOrder[r + 1];
+        G.rank[G.rankOrder[r]] = r;
+        r++;
+    }
+    G.rankOrder[r] = idx;
+    G.rank[idx] = r;
+}
+
+// Take a tile's contribution off / put it back on its owner
+static void _tileStandings(uint8_t tile, int8_t sign) {
+    int8_t o = G.props[tile].owner;
+    if (o < 0) return;
+    G.netWorth[o]    += sign * _tileWorth(tile);
+    G.liquidation[o] += sign * _tileLiquidation(tile);
+}
+
+void game_recomputeStandings() {
+    for (uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        G.netWorth[i] = G.liquidation[i] = G.players[i].money;
+    }
+    for (uint8_t t = 0; t < BOARD_SIZE; t++) _tileStandings(t, +1);
+
+    // Insertion sort; at most MAX_PLAYERS entries
+    for (uint8_t i = 0; i < G.numPlayers; i++) {
+        uint8_t r = i;
+        while (r > 0 && _ahead(i, G.rankOrder[r - 1])) {
+            G.rankOrder[r] = G.rankOrder[r - 1];
+            r--;
+        }
+        G.rankOrder[r] = i;
+    }
+    for (uint8_t r = 0; r < G.numPlayers; r++) G.rank[G.rankOrder[r]] = r;
+}
+
+// =============================================================================
+// CHANGE NOTIFICATIONS
+// =============================================================================
+static game_observer_t _observer = nullptr;
+
+void game_setObserver(game_observer_t cb) {
+    _observer = cb;
+}
+
+static inline void _notify(GameChange what, uint8_t idx) {
+    if (_observer) _observer(what, idx);
+}
+
+void game_setPhase(GamePhase phase) {
+    G.phase = phase;
+    G.screenDirty = true;
+    _notify(GC_PHASE, phase);
+}
+
+// --- Mutators: every write to hashed state goes through one of these -------
+static void _setMoney(uint8_t idx, int32_t money) {
+    Player& p = G.players[idx];
+    int32_t ob = _bucket(p.money), nb = _bucket(money);
+    if (ob != nb) G.hash ^= _zkey(HF_MONEY, idx, ob) ^ _zkey(HF_MONEY, idx, nb);
+    G.netWorth[idx]    += money - p.money;
+    G.liquidation[idx] += money - p.money;
+    p.money = money;
+    _rerank(idx);
+    _notify(GC_MONEY, idx);
+}
+
+static inline void _addMoney(uint8_t idx, int32_t delta) {
+    _setMoney(idx, G.players[idx].money + delta);
+}
+
+static void _setPool(int32_t amount) {
+    int32_t ob = _bucket(G.freeParkingPool), nb = _bucket(amount);
+    if (ob != nb) G.hash ^= _zkey(HF_POOL, 0, ob) ^ _zkey(HF_POOL, 0, nb);
+    G.freeParkingPool = amount;
+}
+
+static void _setPosition(uint8_t idx, uint8_t pos) {
+    Player& p = G.players[idx];
+    G.hash ^= _zkey(HF_POSITION, idx, p.position) ^ _zkey(HF_POSITION, idx, pos);
+    p.position = pos;
+    _notify(GC_POSITION, idx);
+}
+
+static void _setAlive(uint8_t idx, bool alive) {
+    Player& p = G.players[idx];
+    if (p.alive != alive) G.hash ^= _zkey(HF_ALIVE, idx, 0);
+    p.alive = alive;
+    _rerank(idx);
+}
+
+static void _setJail(uint8_t idx, bool inJail, uint8_t turns) {
+    Player& p = G.players[idx];
+    if (p.inJail) G.hash ^= _zkey(HF_JAIL, idx, p.jailTurns);
+    if (inJail)   G.hash ^= _zkey(HF_JAIL, idx, turns);
+    p.inJail    = inJail;
+    p.jailTurns = turns;
+}
+
+static void _setJailCard(uint8_t idx, bool has) {
+    Player& p = G.players[idx];
+    if (p.hasJailCard != has) G.hash ^= _zkey(HF_JAIL_CARD, idx, 0);
+    p.hasJailCard = has;
+}
+
+// Also keeps the owners' ownedTiles bitmasks in step
+static void _setOwner(uint8_t tile, int8_t owner) {
+    PropertyState& ps = G.props[tile];
+    _tileStandings(tile, -1);
+    if (ps.owner >= 0) {
+        G.hash ^= _zkey(HF_OWNER, tile, ps.owner);
+        G.players[ps.owner].ownedTiles &= ~(1ULL << tile);
+    }
+    if (owner >= 0) {
+        G.hash ^= _zkey(HF_OWNER, tile, owner);
+        G.players[owner].ownedTiles |= (1ULL << tile);
+    }
+    int8_t prev = ps.owner;
+    ps.owner = owner;
+    _tileStandings(tile, +1);
+    if (prev >= 0)  _rerank(prev);
+    if (owner >= 0) _rerank(owner);
+    _notify(GC_OWNER, tile);
+}
+
+static void _setHouses(uint8_t tile, uint8_t houses) {
+    PropertyState& ps = G.props[tile];
+    if (ps.houses) G.hash ^= _zkey(HF_HOUSES, tile, ps.houses);
+    if (houses)    G.hash ^= _zkey(HF_HOUSES, tile, houses);
+    _tileStandings(tile, -1);
+    ps.houses = houses;
+    _tileStandings(tile, +1);
+    if (ps.owner >= 0) _rerank(ps.owner);
+    _notify(GC_HOUSES, tile);
+}
+
+static void _setMortgaged(uint8_t tile, bool mortgaged) {
+    PropertyState& ps = G.props[tile];
+    if (ps.mortgaged != mortgaged) G.hash ^= _zkey(HF_MORTGAGED, tile, 0);
+    _tileStandings(tile, -1);
+    ps.mortgaged = mortgaged;
+    _tileStandings(tile, +1);
+    if (ps.owner >= 0) _rerank(ps.owner);
+    _notify(GC_OWNER, tile);
+}
+
+static void _setDeckIdx(bool isChance, uint8_t idx) {
+    uint8_t& cur = isChance ? G.chanceIdx : G.communityIdx;
+    HashFeature f = isChance ? HF_CHANCE_IDX : HF_COMMUNITY_IDX;
+    G.hash ^= _zkey(f, 0, cur) ^ _zkey(f, 0, idx);
+    cur = idx;
+}
+
+void game_setCurrentPlayer(uint8_t playerIdx) {
+    G.hash ^= _zkey(HF_CURRENT, 0, G.currentPlayer) ^ _zkey(HF_CURRENT, 0, playerIdx);
+    G.currentPlayer = playerIdx;
+    HASH_CHECK();
+}
+
 // =============================================================================
 // INIT / NEW GAME
 // =============================================================================
 void game_init() {
     DBG_PRINT("game_init()");
+    GameSettings settings = G.settings;  // loaded / edited separately
     memset(&G, 0, sizeof(G));
+    G.settings = settings;
     G.phase = PHASE_SPLASH;
     G.screenDirty = true;
     for (auto& p : G.props) { p.owner = -1; p.houses = 0; p.mortgaged = false; }
+    game_rehash();
 }
 
 void game_shuffleDecks() {
@@ -28,8 +290,9 @@ void game_shuffleDecks() {
     for (uint8_t i = 0; i < NUM_COMMUNITY_CARDS; i++) G.communityDeck[i] = i;
     _shuffleArray(G.chanceDeck, NUM_CHANCE_CARDS);
     _shuffleArray(G.communityDeck, NUM_COMMUNITY_CARDS);
-    G.chanceIdx = 0;
-    G.communityIdx = 0;
+    _setDeckIdx(true, 0);
+    _setDeckIdx(false, 0);
+    HASH_CHECK();
 }
 
 void game_newGame(uint8_t numPlayers) {
@@ -45,25 +308,23 @@ void game_newGame(uint8_t numPlayers) {
         p.colour   = PLAYER_COLOURS[i];
         snprintf(p.name, MAX_NAME_LEN + 1, "Player %d", i + 1);
     }
-    game_shuffleDecks();
-    G.phase = PHASE_TURN_START;
     G.currentPlayer = 0;
+    game_rehash();
+    game_recomputeStandings();
+    stats_reset(numPlayers);
+    game_shuffleDecks();
     G.turnNumber = 1;
-    G.screenDirty = true;
+    game_setPhase(PHASE_TURN_START);
 }
 
 // =============================================================================
 // TURN FLOW
 // =============================================================================
 void game_startTurn() {
+    stats_onTurnStart();
     Player& p = G.players[G.currentPlayer];
     p.doublesCount = 0;
-    if (p.inJail) {
-        G.phase = PHASE_JAIL_TURN;
-    } else {
-        G.phase = PHASE_TURN_START;
-    }
-    G.screenDirty = true;
+    game_setPhase(p.inJail ? PHASE_JAIL_TURN : PHASE_TURN_START);
 }
 
 void game_rollDice() {
@@ -79,25 +340,25 @@ void game_movePlayer() {
     // Three doubles → jail
     if (p.doublesCount >= 3) {
         game_sendToJail(G.currentPlayer);
-        G.phase = PHASE_TILE_ACTION;
         G.tileAction = ACT_GO_TO_JAIL;
-        G.screenDirty = true;
+        game_setPhase(PHASE_TILE_ACTION);
         return;
     }
     uint8_t total = G.dice1 + G.dice2;
     uint8_t oldPos = p.position;
-    p.position = (p.position + total) % BOARD_SIZE;
+    _setPosition(G.currentPlayer, (p.position + total) % BOARD_SIZE);
+    stats_onLanding(G.currentPlayer, p.position);
     // Passed GO?
     if (p.position < oldPos && p.position != 0) {
-        p.money += GO_SALARY;
+        _addMoney(G.currentPlayer, GO_SALARY);
     }
     // Landed exactly on GO
     if (p.position == 0 && oldPos != 0) {
-        p.money += GO_SALARY;
+        _addMoney(G.currentPlayer, GO_SALARY);
     }
     DBG("movePlayer: P%d  %d -> %d  money=$%ld", G.currentPlayer, oldPos, p.position, p.money);
-    G.phase = PHASE_MOVED;
-    G.screenDirty = true;
+    HASH_CHECK();
+    game_setPhase(PHASE_MOVED);
 }
 
 void game_resolveTile() {
@@ -127,15 +388,13 @@ void game_resolveTile() {
         case TILE_CHANCE:
             G.tileAction = ACT_NONE;
             game_drawCard(true);
-            G.phase = PHASE_CARD_DRAW;
-            G.screenDirty = true;
+            game_setPhase(PHASE_CARD_DRAW);
             return;
 
         case TILE_COMMUNITY:
             G.tileAction = ACT_NONE;
             game_drawCard(false);
-            G.phase = PHASE_CARD_DRAW;
-            G.screenDirty = true;
+            game_setPhase(PHASE_CARD_DRAW);
             return;
 
         case TILE_TAX:
@@ -156,8 +415,7 @@ void game_resolveTile() {
             break;
     }
     DBG("resolveTile: pos=%d tile='%s' action=%d", p.position, tile.name, G.tileAction);
-    G.phase = PHASE_TILE_ACTION;
-    G.screenDirty = true;
+    game_setPhase(PHASE_TILE_ACTION);
 }
 
 // =============================================================================
@@ -169,10 +427,10 @@ bool game_buyProperty(uint8_t playerIdx, uint8_t tileIdx) {
     if (G.props[tileIdx].owner != -1) return false;
     if (p.money < tile.price) return false;
 
-    p.money -= tile.price;
-    G.props[tileIdx].owner = playerIdx;
-    p.ownedTiles |= (1ULL << tileIdx);
+    _addMoney(playerIdx, -tile.price);
+    _setOwner(tileIdx, playerIdx);
     DBG("buyProperty: P%d bought '%s' for $%d  balance=$%ld", playerIdx, tile.name, tile.price, p.money);
+    HASH_CHECK();
     return true;
 }
 
@@ -211,9 +469,11 @@ bool game_payRent(uint8_t fromPlayer, uint8_t tileIdx) {
     if (owner < 0 || rent <= 0) return false;
 
     DBG("payRent: P%d pays $%ld to P%d for '%s'", fromPlayer, rent, owner, TILES[tileIdx].name);
-    G.players[fromPlayer].money -= rent;
-    G.players[owner].money += rent;
+    _addMoney(fromPlayer, -rent);
+    _addMoney(owner, rent);
+    stats_onRent(fromPlayer, owner, tileIdx, rent);
     game_checkBankruptcy(fromPlayer);
+    HASH_CHECK();
     return true;
 }
 
@@ -236,8 +496,9 @@ bool game_buildHouse(uint8_t playerIdx, uint8_t tileIdx) {
         }
     }
 
-    p.money -= tile.houseCost;
-    ps.houses++;
+    _addMoney(playerIdx, -tile.houseCost);
+    _setHouses(tileIdx, ps.houses + 1);
+    HASH_CHECK();
     return true;
 }
 
@@ -254,8 +515,9 @@ bool game_sellHouse(uint8_t playerIdx, uint8_t tileIdx) {
         }
     }
 
-    ps.houses--;
-    G.players[playerIdx].money += tile.houseCost / 2;
+    _setHouses(tileIdx, ps.houses - 1);
+    _addMoney(playerIdx, tile.houseCost / 2);
+    HASH_CHECK();
     return true;
 }
 
@@ -265,8 +527,9 @@ bool game_mortgageProperty(uint8_t playerIdx, uint8_t tileIdx) {
     if (ps.mortgaged) return false;
     if (ps.houses > 0) return false;  // Must sell houses first
 
-    ps.mortgaged = true;
-    G.players[playerIdx].money += TILES[tileIdx].mortgage;
+    _setMortgaged(tileIdx, true);
+    _addMoney(playerIdx, TILES[tileIdx].mortgage);
+    HASH_CHECK();
     return true;
 }
 
@@ -278,19 +541,33 @@ bool game_unmortgageProperty(uint8_t playerIdx, uint8_t tileIdx) {
     int32_t cost = TILES[tileIdx].mortgage + (TILES[tileIdx].mortgage / 10); // 110%
     if (G.players[playerIdx].money < cost) return false;
 
-    ps.mortgaged = false;
-    G.players[playerIdx].money -= cost;
+    _setMortgaged(tileIdx, false);
+    _addMoney(playerIdx, -cost);
+    HASH_CHECK();
     return true;
 }
 
-void game_payBank(uint8_t playerIdx, int32_t amount) {
-    G.players[playerIdx].money -= amount;
-    if (G.settings.freeParkingPool) G.freeParkingPool += amount;
+template <class R>
+static void _payBank(uint8_t playerIdx, int32_t amount) {
+    _addMoney(playerIdx, -amount);
+    if (R::freeParkingPool()) _setPool(G.freeParkingPool + amount);
     game_checkBankruptcy(playerIdx);
+    HASH_CHECK();
+}
+
+void game_payBank(uint8_t playerIdx, int32_t amount) {
+    game_rulesFor(G.settings).payBank(playerIdx, amount);
 }
 
 void game_collectFromBank(uint8_t playerIdx, int32_t amount) {
-    G.players[playerIdx].money += amount;
+    _addMoney(playerIdx, amount);
+    HASH_CHECK();
+}
+
+void game_collectFreeParking(uint8_t playerIdx) {
+    _addMoney(playerIdx, G.freeParkingPool);
+    _setPool(0);
+    HASH_CHECK();
 }
 
 // =============================================================================
@@ -298,46 +575,78 @@ void game_collectFromBank(uint8_t playerIdx, int32_t amount) {
 // =============================================================================
 void game_sendToJail(uint8_t playerIdx) {
     DBG("sendToJail: P%d", playerIdx);
-    Player& p = G.players[playerIdx];
-    p.position = JAIL_POSITION;
-    p.inJail   = true;
-    p.jailTurns = 0;
-    p.doublesCount = 0;
+    _setPosition(playerIdx, JAIL_POSITION);
+    _setJail(playerIdx, true, 0);
+    G.players[playerIdx].doublesCount = 0;
+    HASH_CHECK();
 }
 
-bool game_tryJailRoll(uint8_t playerIdx) {
-    game_rollDice();
+template <class R>
+static void _payJailFine(uint8_t playerIdx) {
+    _addMoney(playerIdx, -JAIL_FINE);
+    _setJail(playerIdx, false, 0);
+    if (R::freeParkingPool()) _setPool(G.freeParkingPool + JAIL_FINE);
+    game_checkBankruptcy(playerIdx);
+    HASH_CHECK();
+}
+
+template <class R>
+static bool _resolveJailRoll(uint8_t playerIdx) {
     Player& p = G.players[playerIdx];
-    p.jailTurns++;
+    _setJail(playerIdx, true, p.jailTurns + 1);
     if (G.isDoubles) {
-        p.inJail = false;
-        p.jailTurns = 0;
+        _setJail(playerIdx, false, 0);
+        HASH_CHECK();
         return true;  // Player is free, move normally
     }
-    if (p.jailTurns >= G.settings.jailMaxTurns) {
+    if (p.jailTurns >= R::jailMaxTurns()) {
         // Forced to pay
-        game_payJailFine(playerIdx);
+        _payJailFine<R>(playerIdx);
         return true;
     }
+    HASH_CHECK();
     return false;  // Still in jail
 }
 
+bool game_tryJailRoll(uint8_t playerIdx) {
+    game_rollDice();
+    return game_resolveJailRoll(playerIdx);
+}
+
+bool game_resolveJailRoll(uint8_t playerIdx) {
+    return game_rulesFor(G.settings).resolveJailRoll(playerIdx);
+}
+
 void game_payJailFine(uint8_t playerIdx) {
-    Player& p = G.players[playerIdx];
-    p.money -= JAIL_FINE;
-    p.inJail = false;
-    p.jailTurns = 0;
-    if (G.settings.freeParkingPool) G.freeParkingPool += JAIL_FINE;
-    game_checkBankruptcy(playerIdx);
+    game_rulesFor(G.settings).payJailFine(playerIdx);
 }
 
 void game_useJailCard(uint8_t playerIdx) {
     Player& p = G.players[playerIdx];
     if (p.hasJailCard) {
-        p.hasJailCard = false;
-        p.inJail = false;
-        p.jailTurns = 0;
+        _setJailCard(playerIdx, false);
+        _setJail(playerIdx, false, 0);
     }
+    HASH_CHECK();
+}
+
+// =============================================================================
+// RULES DISPATCH
+// =============================================================================
+#define RULES_OPS(fp, jt) \
+    { &_payBank<Rules<fp, jt>>, &_payJailFine<Rules<fp, jt>>, &_resolveJailRoll<Rules<fp, jt>> }
+
+static const RulesOps RULES_TABLE[2][MAX_JAIL_TURNS] = {
+    { RULES_OPS(false, 1), RULES_OPS(false, 2), RULES_OPS(false, 3), RULES_OPS(false, 4), RULES_OPS(false, 5) },
+    { RULES_OPS(true,  1), RULES_OPS(true,  2), RULES_OPS(true,  3), RULES_OPS(true,  4), RULES_OPS(true,  5) },
+};
+static_assert(MAX_JAIL_TURNS == 5, "RULES_TABLE needs one column per jailMaxTurns value");
+
+const RulesOps& game_rulesFor(const GameSettings& s) {
+    uint8_t jt = s.jailMaxTurns;
+    if (jt < 1) jt = 1;
+    if (jt > MAX_JAIL_TURNS) jt = MAX_JAIL_TURNS;
+    return RULES_TABLE[s.freeParkingPool ? 1 : 0][jt - 1];
 }
 
 // =============================================================================
@@ -347,13 +656,14 @@ void game_drawCard(bool isChance) {
     G.cardIsChance = isChance;
     if (isChance) {
         G.cardIndex = G.chanceDeck[G.chanceIdx];
-        G.chanceIdx = (G.chanceIdx + 1) % NUM_CHANCE_CARDS;
+        _setDeckIdx(true, (G.chanceIdx + 1) % NUM_CHANCE_CARDS);
         DBG("drawCard: Chance #%d", G.cardIndex);
     } else {
         G.cardIndex = G.communityDeck[G.communityIdx];
-        G.communityIdx = (G.communityIdx + 1) % NUM_COMMUNITY_CARDS;
+        _setDeckIdx(false, (G.communityIdx + 1) % NUM_COMMUNITY_CARDS);
         DBG("drawCard: Community #%d", G.cardIndex);
     }
+    HASH_CHECK();
 }
 
 void game_applyCard(const CardData& card) {
@@ -364,18 +674,18 @@ void game_applyCard(const CardData& card) {
         case CARD_MOVETO: {
             uint8_t dest = (uint8_t)card.value1;
             if (dest < p.position && dest != JAIL_POSITION) {
-                p.money += GO_SALARY;  // passed GO
+                _addMoney(cp, GO_SALARY);  // passed GO
             }
-            p.position = dest;
+            _setPosition(cp, dest);
             break;
         }
         case CARD_MOVEREL: {
             int8_t delta = (int8_t)card.value1;
-            p.position = (uint8_t)((int16_t)p.position + delta + BOARD_SIZE) % BOARD_SIZE;
+            _setPosition(cp, (uint8_t)((int16_t)p.position + delta + BOARD_SIZE) % BOARD_SIZE);
             break;
         }
         case CARD_COLLECT:
-            p.money += card.value1;
+            _addMoney(cp, card.value1);
             break;
 
         case CARD_PAY:
@@ -385,8 +695,8 @@ void game_applyCard(const CardData& card) {
         case CARD_COLLECT_EACH:
             for (uint8_t i = 0; i < G.numPlayers; i++) {
                 if (i != cp && G.players[i].alive) {
-                    G.players[i].money -= card.value1;
-                    p.money += card.value1;
+                    _addMoney(i, -card.value1);
+                    _addMoney(cp, card.value1);
                     game_checkBankruptcy(i);
                 }
             }
@@ -395,15 +705,15 @@ void game_applyCard(const CardData& card) {
         case CARD_PAY_EACH:
             for (uint8_t i = 0; i < G.numPlayers; i++) {
                 if (i != cp && G.players[i].alive) {
-                    p.money -= card.value1;
-                    G.players[i].money += card.value1;
+                    _addMoney(cp, -card.value1);
+                    _addMoney(i, card.value1);
                 }
             }
             game_checkBankruptcy(cp);
             break;
 
         case CARD_JAIL_FREE:
-            p.hasJailCard = true;
+            _setJailCard(cp, true);
             break;
 
         case CARD_GO_JAIL:
@@ -430,13 +740,14 @@ void game_applyCard(const CardData& card) {
                 if (rrs[i] > pos) { nearest = rrs[i]; break; }
                 if (i == 3) { nearest = rrs[0]; } // wrap around
             }
-            if (nearest <= p.position) p.money += GO_SALARY;
-            p.position = nearest;
+            if (nearest <= p.position) _addMoney(cp, GO_SALARY);
+            _setPosition(cp, nearest);
             // Pay double rent if owned
             if (G.props[nearest].owner >= 0 && G.props[nearest].owner != (int8_t)cp) {
                 int32_t rent = game_calcRent(nearest, G.dice1 + G.dice2) * 2;
-                G.players[cp].money -= rent;
-                G.players[G.props[nearest].owner].money += rent;
+                _addMoney(cp, -rent);
+                _addMoney(G.props[nearest].owner, rent);
+                stats_onRent(cp, G.props[nearest].owner, nearest, rent);
                 game_checkBankruptcy(cp);
             }
             break;
@@ -444,18 +755,26 @@ void game_applyCard(const CardData& card) {
         case CARD_NEAREST_UTIL: {
             uint8_t pos = p.position;
             uint8_t nearest = (pos < 12 || pos >= 28) ? 12 : 28;
-            if (nearest <= p.position && nearest != 12) p.money += GO_SALARY;
-            p.position = nearest;
+            if (nearest <= p.position && nearest != 12) _addMoney(cp, GO_SALARY);
+            _setPosition(cp, nearest);
             // Pay 10× dice if owned
             if (G.props[nearest].owner >= 0 && G.props[nearest].owner != (int8_t)cp) {
                 int32_t rent = (G.dice1 + G.dice2) * 10;
-                G.players[cp].money -= rent;
-                G.players[G.props[nearest].owner].money += rent;
+                _addMoney(cp, -rent);
+                _addMoney(G.props[nearest].owner, rent);
+                stats_onRent(cp, G.props[nearest].owner, nearest, rent);
                 game_checkBankruptcy(cp);
             }
             break;
         }
     }
+    // Counted where the token moves, as in game_movePlayer(): the UI only runs
+    // game_resolveTile() for some card destinations
+    if (card.effect == CARD_MOVETO || card.effect == CARD_MOVEREL
+        || card.effect == CARD_NEAREST_RR || card.effect == CARD_NEAREST_UTIL) {
+        stats_onLanding(cp, p.position);
+    }
+    HASH_CHECK();
 }
 
 // =============================================================================
@@ -476,28 +795,19 @@ bool game_executeTrade() {
     if ((them.ownedTiles & G.tradePropsRequest) != G.tradePropsRequest) return false;
 
     // Execute money
-    me.money   -= G.tradeMoneyOffer;
-    them.money += G.tradeMoneyOffer;
-    me.money   += G.tradeMoneyRequest;
-    them.money -= G.tradeMoneyRequest;
+    _addMoney(cp, G.tradeMoneyRequest - G.tradeMoneyOffer);
+    _addMoney(tp, G.tradeMoneyOffer - G.tradeMoneyRequest);
 
-    // Transfer offered properties
+    // Transfer offered properties (_setOwner moves the ownedTiles bits)
     for (int i = 0; i < BOARD_SIZE; i++) {
-        if (G.tradePropsOffer & (1ULL << i)) {
-            G.props[i].owner = tp;
-            me.ownedTiles   &= ~(1ULL << i);
-            them.ownedTiles |= (1ULL << i);
-        }
-        if (G.tradePropsRequest & (1ULL << i)) {
-            G.props[i].owner = cp;
-            them.ownedTiles &= ~(1ULL << i);
-            me.ownedTiles   |= (1ULL << i);
-        }
+        if (G.tradePropsOffer & (1ULL << i))   _setOwner(i, tp);
+        if (G.tradePropsRequest & (1ULL << i)) _setOwner(i, cp);
     }
 
     // Reset trade state
     G.tradeMoneyOffer = G.tradeMoneyRequest = 0;
     G.tradePropsOffer = G.tradePropsRequest = 0;
+    HASH_CHECK();
     return true;
 }
 
@@ -508,14 +818,16 @@ void game_endTurn() {
     Player& p = G.players[G.currentPlayer];
     if (G.isDoubles && p.alive && !p.inJail) {
         DBG("endTurn: P%d rolls again (doubles)", G.currentPlayer);
-        G.phase = PHASE_TURN_START;
-        G.screenDirty = true;
+        game_setPhase(PHASE_TURN_START);
         return;
     }
     // Next player
+    stats_onTurnEnd();
+    uint8_t next = G.currentPlayer;
     do {
-        G.currentPlayer = (G.currentPlayer + 1) % G.numPlayers;
-    } while (!G.players[G.currentPlayer].alive);
+        next = (next + 1) % G.numPlayers;
+    } while (!G.players[next].alive);
+    game_setCurrentPlayer(next);
     G.turnNumber++;
     DBG("endTurn: next=P%d  turn=%d", G.currentPlayer, G.turnNumber);
     game_startTurn();
@@ -527,22 +839,21 @@ void game_checkBankruptcy(uint8_t playerIdx) {
         DBG("BANKRUPT: P%d  money=$%ld", playerIdx, p.money);
         // For simplicity: auto-bankrupt (real game would offer mortgage/sell)
         // TODO: offer player chance to mortgage / sell before going bankrupt
-        p.alive = false;
+        _setAlive(playerIdx, false);
         G.alivePlayers--;
         // Return properties to bank
         for (int i = 0; i < BOARD_SIZE; i++) {
             if (G.props[i].owner == (int8_t)playerIdx) {
-                G.props[i].owner = -1;
-                G.props[i].houses = 0;
-                G.props[i].mortgaged = false;
+                _setOwner(i, -1);
+                _setHouses(i, 0);
+                _setMortgaged(i, false);
             }
         }
-        p.ownedTiles = 0;
         if (game_isGameOver()) {
-            G.phase = PHASE_GAME_OVER;
-            G.screenDirty = true;
+            game_setPhase(PHASE_GAME_OVER);
         }
     }
+    HASH_CHECK();
 }
 
 bool game_isGameOver() {
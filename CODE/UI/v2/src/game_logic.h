@@ -52,6 +52,7 @@ enum GamePhase : uint8_t {
     PHASE_PROGRAMMING,
     PHASE_SETTINGS,
     PHASE_GAME_OVER,
+    PHASE_GAME_STATS,
 };
 
 // Sub-actions for PHASE_TILE_ACTION
@@ -112,12 +113,51 @@ struct GameState {
     // Turn history
     uint16_t    turnNumber    = 0;
 
+    // Zobrist hash of the rules-relevant state, kept up to date by every
+    // game_* mutator. Not saved; rebuilt with game_rehash() after a load.
+    uint64_t    hash          = 0;
+
+    // Standings, kept up to date by the same mutators as the hash. Not saved;
+    // rebuilt with game_recomputeStandings() after a load.
+    int32_t     netWorth[MAX_PLAYERS];     // cash + property / building value
+    int32_t     liquidation[MAX_PLAYERS];  // cash raisable now (sell + mortgage)
+    uint8_t     rankOrder[MAX_PLAYERS];    // player idx, richest first, bankrupt last
+    uint8_t     rank[MAX_PLAYERS];         // inverse of rankOrder (0 = leader)
+
     // Dirty flags for UI
     bool        screenDirty   = true;
 };
 
 extern GameState G;
 
+// =============================================================================
+// RULE POLICIES
+// =============================================================================
+// House rules that change engine arithmetic are a template parameter of the
+// rule-dependent paths, so every ruleset compiles to its own branch-free code.
+// RuntimeRules reads G.settings on each use instead (the flag-checking path).
+// autoRent and nfcRequired only change UI flow and stay plain settings.
+template <bool FreeParkingPool, uint8_t JailMaxTurns>
+struct Rules {
+    static bool    freeParkingPool() { return FreeParkingPool; }
+    static uint8_t jailMaxTurns()    { return JailMaxTurns; }
+};
+
+struct RuntimeRules {
+    static bool    freeParkingPool() { return G.settings.freeParkingPool; }
+    static uint8_t jailMaxTurns()    { return G.settings.jailMaxTurns; }
+};
+
+// One instantiation of the rule-dependent engine calls
+struct RulesOps {
+    void (*payBank)(uint8_t playerIdx, int32_t amount);
+    void (*payJailFine)(uint8_t playerIdx);
+    bool (*resolveJailRoll)(uint8_t playerIdx);
+};
+
+// Instantiation matching the given settings (jailMaxTurns clamped to 1..MAX)
+const RulesOps& game_rulesFor(const GameSettings& s);
+
 // =============================================================================
 // GAME ENGINE API
 // =============================================================================
@@ -143,10 +183,12 @@ bool game_mortgageProperty(uint8_t playerIdx, uint8_t tileIdx);
 bool game_unmortgageProperty(uint8_t playerIdx, uint8_t tileIdx);
 void game_payBank(uint8_t playerIdx, int32_t amount);
 void game_collectFromBank(uint8_t playerIdx, int32_t amount);
+void game_collectFreeParking(uint8_t playerIdx);  // Pool → player, pool = 0
 
 // Jail
 void game_sendToJail(uint8_t playerIdx);
-bool game_tryJailRoll(uint8_t playerIdx);
+bool game_tryJailRoll(uint8_t playerIdx);      // Rolls, then resolveJailRoll
+bool game_resolveJailRoll(uint8_t playerIdx);  // Apply dice already in G
 void game_payJailFine(uint8_t playerIdx);
 void game_useJailCard(uint8_t playerIdx);
 
@@ -168,3 +210,25 @@ bool game_ownsFullGroup(uint8_t playerIdx, ColorGroup group);
 uint8_t game_countInGroup(uint8_t playerIdx, ColorGroup group);
 uint8_t game_playerRailroads(uint8_t playerIdx);
 uint8_t game_playerUtilities(uint8_t playerIdx);
+
+// State hash (positions, ownership, houses, mortgages, money buckets, jail,
+// deck indices, current player, free parking pool bucket)
+uint64_t game_computeHash();                  // Full recompute from G
+void game_rehash();                           // G.hash = game_computeHash()
+void game_setCurrentPlayer(uint8_t playerIdx);
+
+// Standings (netWorth / liquidation / rank are maintained incrementally)
+void game_recomputeStandings();              // Full rebuild from G
+
+// =============================================================================
+// CHANGE NOTIFICATIONS
+// =============================================================================
+// The mutators report every field they write, after writing it: idx is the
+// player for money / position, the tile for ownership (owner or mortgage) /
+// houses, and the new phase for GC_PHASE. Bulk resets (game_init,
+// game_newGame, loading a save) are not reported; they change the phase.
+enum GameChange : uint8_t { GC_MONEY, GC_POSITION, GC_OWNER, GC_HOUSES, GC_PHASE, GC_KINDS };
+typedef void (*game_observer_t)(GameChange what, uint8_t idx);
+
+void game_setObserver(game_observer_t cb);    // one observer (the UI); nullptr = none
+void game_setPhase(GamePhase phase);          // G.phase + screenDirty, reported
@@ -0,0 +1,142 @@
+#include "game_stats.h"
+#include "game_logic.h"
+
+GameStats S;
+
+// =============================================================================
+// HOOKS
+// =============================================================================
+void stats_reset(uint8_t numPlayers) {
+    memset(&S, 0, sizeof(S));
+    S.turnStartMs = millis();
+    // First sample = starting balances
+    for (uint8_t i = 0; i < numPlayers; i++) S.cash[i][0] = G.players[i].money;
+    S.cashHead  = 1 % STATS_CASH_SAMPLES;
+    S.cashCount = 1;
+}
+
+void stats_onLanding(uint8_t playerIdx, uint8_t tileIdx) {
+    if (S.landings[playerIdx][tileIdx] < UINT16_MAX) S.landings[playerIdx][tileIdx]++;
+}
+
+void stats_onRent(uint8_t fromPlayer, uint8_t toPlayer, uint8_t tileIdx, int32_t amount) {
+    S.rentByTile[tileIdx]       += amount;
+    S.rentPaid[fromPlayer]      += amount;
+    S.rentCollected[toPlayer]   += amount;
+}
+
+void stats_onTurnStart() {
+    S.turnStartMs = millis();
+}
+
+void stats_onTurnEnd() {
+    // Turn time
+    uint32_t dt = millis() - S.turnStartMs;
+    if (S.turns < UINT16_MAX) S.turns++;
+    S.turnTotalMs += dt;
+    if (dt > S.turnMaxMs) S.turnMaxMs = dt;
+    uint8_t b = 0;
+    for (uint32_t lim = 2000; dt >= lim && b < STATS_TURN_BUCKETS - 1; lim <<= 1) b++;
+    S.turnHist[b]++;
+
+    // Cash sample, over the oldest once the ring is full
+    for (uint8_t p = 0; p < G.numPlayers; p++) S.cash[p][S.cashHead] = G.players[p].money;
+    S.cashHead = (S.cashHead + 1) % STATS_CASH_SAMPLES;
+    if (S.cashCount < STATS_CASH_SAMPLES) S.cashCount++;
+    else if (S.cashDropped < UINT16_MAX)  S.cashDropped++;
+}
+
+// =============================================================================
+// QUERIES
+// =============================================================================
+uint8_t stats_topRentTiles(uint8_t* out, uint8_t max) {
+    uint8_t n = 0;
+    for (uint8_t t = 0; t < BOARD_SIZE; t++) {
+        if (!S.rentByTile[t] || !max) continue;
+        // Insert into the short sorted list (drop the last entry when full)
+        uint8_t i = n;
+        if (n < max) n++;
+        else if (S.rentByTile[t] <= S.rentByTile[out[max - 1]]) continue;
+        else i = max - 1;
+        while (i > 0 && S.rentByTile[out[i - 1]] < S.rentByTile[t]) {
+            out[i] = out[i - 1];
+            i--;
+        }
+        out[i] = t;
+    }
+    return n;
+}
+
+uint8_t stats_mostLandedTile() {
+    uint8_t best = 0;
+    uint32_t bestN = 0;
+    for (uint8_t t = 0; t < BOARD_SIZE; t++) {
+        uint32_t n = 0;
+        for (uint8_t p = 0; p < G.numPlayers; p++) n += S.landings[p][t];
+        if (n > bestN) { bestN = n; best = t; }
+    }
+    return best;
+}
+
+uint32_t stats_avgTurnMs() {
+    return S.turns ? S.turnTotalMs / S.turns : 0;
+}
+
+int32_t stats_cash(uint8_t playerIdx, uint8_t i) {
+    uint8_t oldest = (S.cashHead + STATS_CASH_SAMPLES - S.cashCount) % STATS_CASH_SAMPLES;
+    return S.cash[playerIdx][(oldest + i) % STATS_CASH_SAMPLES];
+}
+
+// =============================================================================
+// BINARY EXPORT
+// =============================================================================
+// Frame:  "MST" ver(1)  body  crc16(body, CCITT, LE)
+// Body (all integers LEB128 varints, cash zig-zag encoded):
+//   numPlayers cashCount cashDropped turns turnTotalMs turnMaxMs turnHist[8]
+//   per player: landings[40] rentPaid rentCollected cash[cashCount] (oldest first)
+//   rentByTile[40]
+struct _Writer {
+    Print&   out;
+    uint16_t crc = 0xFFFF;
+    size_t   n   = 0;
+
+    explicit _Writer(Print& p) : out(p) {}
+
+    void byte(uint8_t b) {
+        out.write(b);
+        n++;
+        crc ^= (uint16_t)b << 8;
+        for (uint8_t i = 0; i < 8; i++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    void var(uint32_t v) {
+        while (v >= 0x80) { byte((uint8_t)(v | 0x80)); v >>= 7; }
+        byte((uint8_t)v);
+    }
+    void zig(int32_t v) { var(((uint32_t)v << 1) ^ (uint32_t)(v >> 31)); }
+};
+
+size_t stats_export(Print& out) {
+    out.write((const uint8_t*)"MST\x02", 4);
+
+    _Writer w(out);
+    w.var(G.numPlayers);
+    w.var(S.cashCount);
+    w.var(S.cashDropped);
+    w.var(S.turns);
+    w.var(S.turnTotalMs);
+    w.var(S.turnMaxMs);
+    for (uint8_t b = 0; b < STATS_TURN_BUCKETS; b++) w.var(S.turnHist[b]);
+
+    for (uint8_t p = 0; p < G.numPlayers; p++) {
+        for (uint8_t t = 0; t < BOARD_SIZE; t++) w.var(S.landings[p][t]);
+        w.var(S.rentPaid[p]);
+        w.var(S.rentCollected[p]);
+        for (uint8_t i = 0; i < S.cashCount; i++) w.zig(stats_cash(p, i));
+    }
+    for (uint8_t t = 0; t < BOARD_SIZE; t++) w.var(S.rentByTile[t]);
+
+    uint16_t crc = w.crc;
+    out.write((uint8_t)(crc & 0xFF));
+    out.write((uint8_t)(crc >> 8));
+    return 4 + w.n + 2;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// =============================================================================
+// GAME STATISTICS  (fixed footprint, filled by hooks in game_logic.cpp)
+// =============================================================================
+// Cash history: a ring of one balance sample per player per turn, starting
+// with the opening balances. Once STATS_CASH_SAMPLES are in, each turn
+// overwrites the oldest, so the chart shows the most recent turns at full
+// resolution.
+
+#ifndef STATS_CASH_SAMPLES
+  #define STATS_CASH_SAMPLES 32
+#endif
+#define STATS_TURN_BUCKETS   8      // turn-time histogram: <2s, <4s, ... ≥128s
+
+struct GameStats {
+    // Landings (player × tile) and rent per tile
+    uint16_t landings[MAX_PLAYERS][BOARD_SIZE];
+    uint32_t rentByTile[BOARD_SIZE];             // paid by lander = earned by owner
+
+    // Rent per player
+    uint32_t rentPaid[MAX_PLAYERS];
+    uint32_t rentCollected[MAX_PLAYERS];
+
+    // Cash history (ring; read it through stats_cash())
+    int32_t  cash[MAX_PLAYERS][STATS_CASH_SAMPLES];
+    uint8_t  cashHead;                           // slot the next sample goes in
+    uint8_t  cashCount;                          // samples in use
+    uint16_t cashDropped;                        // samples overwritten = turn of the oldest kept
+
+    // Turn durations
+    uint32_t turnStartMs;
+    uint16_t turns;
+    uint32_t turnTotalMs;
+    uint32_t turnMaxMs;
+    uint16_t turnHist[STATS_TURN_BUCKETS];
+};
+
+extern GameStats S;
+
+// Engine hooks (no allocation, O(1))
+void stats_reset(uint8_t numPlayers);
+void stats_onLanding(uint8_t playerIdx, uint8_t tileIdx);
+void stats_onRent(uint8_t fromPlayer, uint8_t toPlayer, uint8_t tileIdx, int32_t amount);
+void stats_onTurnStart();
+void stats_onTurnEnd();                          // samples cash, times the turn
+
+// Queries for the report screen
+uint8_t stats_topRentTiles(uint8_t* out, uint8_t max);   // tile idx, richest first
+uint8_t stats_mostLandedTile();                          // over all players
+uint32_t stats_avgTurnMs();
+int32_t  stats_cash(uint8_t playerIdx, uint8_t i);       // i-th sample, oldest first
+
+// Binary report over serial (see game_stats.cpp for the frame layout)
+size_t stats_export(Print& out);
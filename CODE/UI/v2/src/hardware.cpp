@@ -1,6 +1,10 @@
 #include "hardware.h"
 #include <lvgl.h>
 #include <Wire.h>
+#include <esp_attr.h>
+#include <LightSleep.h>          // CODE/lib, shared with esp32Code
+#include "nfc_handler.h"
+#include "timer_wheel.h"
 
 // =============================================================================
 // GLOBALS
@@ -12,37 +16,96 @@ TFT_eSPI tft = TFT_eSPI();
 // =============================================================================
 void hw_initDisplay() {
     DBG_PRINT("Display init start");
-    pinMode(PIN_TFT_BL, OUTPUT);
-    digitalWrite(PIN_TFT_BL, HIGH);
+    ledcSetup(BL_LEDC_CH, BL_PWM_HZ, 8);
+    ledcAttachPin(PIN_TFT_BL, BL_LEDC_CH);
+    hw_setBacklight(BL_FULL);
 
     tft.init();
     tft.setRotation(1);           // landscape
     tft.fillScreen(TFT_BLACK);
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     tft.setTextSize(1);
+    tft.setSwapBytes(false);      // LVGL swaps; pushImageDMA must not swap again
+    tft.initDMA();
     DBG("Display init done: %dx%d rotation=%d", tft.width(), tft.height(), tft.getRotation());
 }
 
+static uint8_t  _blLevel   = 0;
+static uint32_t _blMark    = 0;        // millis() of the last level change
+static uint64_t _blLevelMs = 0;        // sum of level x ms, for the current estimate
+
+static void _blAccount(uint32_t now) {
+    _blLevelMs += (uint64_t)(now - _blMark) * _blLevel;
+    _blMark = now;
+}
+
+void hw_setBacklight(uint8_t level) {
+    _blAccount(millis());
+    _blLevel = level;
+    ledcWrite(BL_LEDC_CH, level);
+}
+
 void hw_backlight(bool on) {
-    digitalWrite(PIN_TFT_BL, on ? HIGH : LOW);
+    hw_setBacklight(on ? BL_FULL : 0);
+}
+
+// =============================================================================
+// INPUT WAKE  (button and PENIRQ edges, and NFC results, wake the render task)
+// =============================================================================
+static TaskHandle_t volatile _wakeTask = nullptr;
+static volatile uint32_t     _irqUs    = 0;    // first input edge not yet handled
+static volatile bool         _woken    = false;  // hw_wake() since the last hw_idle()
+
+static void IRAM_ATTR _wakeFromIsr() {
+    if (!_irqUs) _irqUs = micros();
+    TaskHandle_t t = _wakeTask;
+    if (!t) return;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(t, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+// The flag outlives the notification, which _touchPoll() may take
+void hw_wake() {
+    _woken = true;
+    TaskHandle_t t = _wakeTask;
+    if (t) xTaskNotifyGive(t);
 }
 
 // =============================================================================
 // TOUCH  (XPT2046 via TFT_eSPI built-in driver)
 // =============================================================================
-static uint32_t _lastTouchMs = 0;
+// PENIRQ goes low while the panel is pressed. Nothing is read over SPI (the
+// bus shared with the display) unless it fell since the last read or is
+// still low.
+static uint32_t      _lastTouchMs = 0;
+static volatile bool _penIrq      = false;     // falling edge since the last read
+static TouchStats    _touchStats;
+
+static void IRAM_ATTR _onPenIrq() {
+    _penIrq = true;
+    _wakeFromIsr();
+}
+
+static inline bool _penDown() {
+    return _penIrq || digitalRead(PIN_TOUCH_IRQ) == LOW;
+}
 
 void hw_initTouch() {
     uint16_t calData[5] = {300, 3600, 300, 3600, 1};   // last value must match tft.setRotation()
     tft.setTouch(calData);
     pinMode(PIN_TOUCH_IRQ, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(PIN_TOUCH_IRQ), _onPenIrq, FALLING);
     DBG_PRINT("Touch init done");
 }
 
+TouchStats hw_touchStats() { return _touchStats; }
+
 TouchPoint hw_getTouch() {
     TouchPoint tp;
     uint16_t tx, ty;
-    if (tft.getTouch(&tx, &ty, 40)) {
+    if (!_penDown()) return tp;
+    if (tft.getTouch(&tx, &ty, TOUCH_Z_MIN)) {
         if (millis() - _lastTouchMs > TOUCH_DEBOUNCE_MS) {
             tp.x = tx;
             tp.y = ty;
@@ -65,10 +128,18 @@ static const uint8_t _btnPins[3] = {PIN_BTN_LEFT, PIN_BTN_CENTER, PIN_BTN_RIGHT}
 static bool  _btnPrev[3]     = {false, false, false};
 static uint32_t _btnTime[3]  = {0, 0, 0};
 static bool  _btnDown[3]     = {false, false, false};
+static volatile bool _btnIrq = false;          // edge since the keypad's last read
+
+static void IRAM_ATTR _onBtnIrq() {
+    _btnIrq = true;
+    _wakeFromIsr();
+}
 
 void hw_initButtons() {
     for (int i = 0; i < 3; i++) {
         pinMode(_btnPins[i], INPUT_PULLUP);
+        // Both edges: the keypad indev is read on press and again on release
+        attachInterrupt(digitalPinToInterrupt(_btnPins[i]), _onBtnIrq, CHANGE);
     }
     DBG_PRINT("Buttons init done");
 }
@@ -87,6 +158,16 @@ BtnId hw_readButtons() {
     return BTN_NONE;
 }
 
+// The press that lit a dark screen: held buttons count as already reported,
+// and bounces restart the debounce
+static void _swallowButtons() {
+    _btnIrq = false;
+    for (int i = 0; i < 3; i++) {
+        _btnPrev[i] = digitalRead(_btnPins[i]) == LOW;
+        _btnTime[i] = millis();
+    }
+}
+
 bool hw_isBtnHeld(BtnId b, uint32_t ms) {
     if (b == BTN_NONE || b > BTN_RIGHT) return false;
     uint8_t idx = b - 1;
@@ -99,7 +180,7 @@ bool hw_isBtnHeld(BtnId b, uint32_t ms) {
 static const Note* _melody  = nullptr;
 static uint8_t     _melLen  = 0;
 static uint8_t     _melIdx  = 0;
-static uint32_t    _noteStart = 0;
+static tw_id_t     _noteTimer = TW_NONE;   // ends the current note
 static uint8_t     _volume    = 3;   // 0-5
 
 void hw_initAudio() {
@@ -112,35 +193,31 @@ void hw_setVolume(uint8_t vol) {
     _volume = vol > 5 ? 5 : vol;
     if (_volume == 0) {
         noTone(PIN_SPEAKER);
+        tw_cancel(_noteTimer);
         _melody = nullptr;
     }
 }
 
+static void _startNote() {
+    if (_melody[_melIdx].freq > 0) tone(PIN_SPEAKER, _melody[_melIdx].freq);
+    else                           noTone(PIN_SPEAKER);
+    _noteTimer = tw_start(_melody[_melIdx].durationMs, [](void*) {
+        if (++_melIdx >= _melLen) {
+            _melody = nullptr;
+            noTone(PIN_SPEAKER);
+            return;
+        }
+        _startNote();
+    }, nullptr);
+}
+
 void hw_playMelody(const Note* melody, uint8_t len) {
     if (_volume == 0) return;
+    tw_cancel(_noteTimer);
     _melody   = melody;
     _melLen   = len;
     _melIdx   = 0;
-    _noteStart = millis();
-    if (_melody[0].freq > 0) tone(PIN_SPEAKER, _melody[0].freq);
-    else                     noTone(PIN_SPEAKER);
-}
-
-void hw_updateAudio() {
-    if (!_melody) return;
-    if (millis() - _noteStart >= _melody[_melIdx].durationMs) {
-        _melIdx++;
-        if (_melIdx >= _melLen) {
-            _melody = nullptr;
-            noTone(PIN_SPEAKER);
-            return;
-        }
-        _noteStart = millis();
-        if (_melody[_melIdx].freq > 0)
-            tone(PIN_SPEAKER, _melody[_melIdx].freq);
-        else
-            noTone(PIN_SPEAKER);
-    }
+    _startNote();
 }
 
 // ---- Pre-built melodies ----
@@ -189,37 +266,121 @@ void hw_playJail()    { hw_playMelody(_jail, 3); }
 // LVGL DISPLAY + INPUT DRIVERS
 // =============================================================================
 
-// Draw buffer (1/10 of screen, 2 bytes per pixel for RGB565)
+// Two draw buffers (1/10 of screen each, RGB565) in internal DMA-capable RAM:
+// LVGL renders into one while the other is still going out over SPI
 #define DRAW_BUF_LINES 24
-static uint8_t _lvBuf[SCREEN_W * DRAW_BUF_LINES * sizeof(lv_color16_t)];
+DMA_ATTR static uint8_t _lvBuf[2][SCREEN_W * DRAW_BUF_LINES * sizeof(lv_color16_t)];
+
+static DisplayStats _dispStats;
+
+static void _wakeAnswered();
 
-// Display flush callback: push rendered pixels to TFT via SPI
+// Display flush callback: start the DMA transfer and return; LVGL moves on to
+// the next area in the other buffer
 static void _lvgl_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
-    uint32_t w = area->x2 - area->x1 + 1;
-    uint32_t h = area->y2 - area->y1 + 1;
-    tft.startWrite();
-    tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.pushColors((uint16_t*)px_map, w * h, true);   // true = swap bytes for SPI
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    lv_draw_sw_rgb565_swap(px_map, w * h);          // panel wants big-endian RGB565
+    tft.startWrite();                               // ended in _lvgl_flush_wait_cb
+    tft.pushImageDMA(area->x1, area->y1, w, h, (uint16_t*)px_map);
+    _dispStats.flushes++;
+    if (lv_display_flush_is_last(disp)) {
+        _dispStats.frames++;
+        _wakeAnswered();
+    }
+}
+
+// Called by LVGL before it reuses a buffer that is still flushing. TFT_eSPI
+// has no completion callback, so the transfer is finished here. Touch reads
+// wait for the DMA inside TFT_eSPI.
+static void _lvgl_flush_wait_cb(lv_display_t* disp) {
+    if (tft.dmaBusy()) {
+        uint32_t t0 = micros();
+        tft.dmaWait();
+        _dispStats.waitUs += micros() - t0;
+    }
     tft.endWrite();
     lv_display_flush_ready(disp);
 }
 
-// Touch input read callback
-static uint16_t _calData[5] = {300, 3600, 300, 3600, 3};
+DisplayStats hw_displayStats() { return _dispStats; }
+
+// Touch input: the indev runs in event mode and is read from _touchPoll, at
+// LVGL's own read period, only while the pen is down. The poll timer pauses
+// itself once the pen is up; PENIRQ resumes it through _onInputWake. During contact the
+// position is the median of TOUCH_SAMPLES raw conversions, which drops the
+// odd wild sample an XPT2046 gives at light pressure.
+static lv_indev_t* _touchIndev = nullptr;
+static lv_timer_t* _touchTimer = nullptr;
+static bool        _touching   = false;        // last read saw contact
+static bool        _swallowTouch = false;      // contact that lit the screen, until lift-off
+
+static uint16_t _median(uint16_t* v, uint8_t n) {
+    for (uint8_t i = 1; i < n; i++) {
+        uint16_t x = v[i];
+        uint8_t  j = i;
+        for (; j > 0 && v[j - 1] > x; j--) v[j] = v[j - 1];
+        v[j] = x;
+    }
+    return v[n / 2];
+}
 
 static void _lvgl_touch_read_cb(lv_indev_t* indev, lv_indev_data_t* data) {
-    uint16_t tx, ty;
-    if (tft.getTouch(&tx, &ty, 40)) {
-        data->point.x = tx;
-        data->point.y = ty;
-        data->state   = LV_INDEV_STATE_PRESSED;
-    } else {
-        data->state = LV_INDEV_STATE_RELEASED;
+    uint32_t t0 = micros();
+    data->state = LV_INDEV_STATE_RELEASED;
+    if (tft.getTouchRawZ() >= TOUCH_Z_MIN) {
+        uint16_t xs[TOUCH_SAMPLES], ys[TOUCH_SAMPLES];
+        for (uint8_t i = 0; i < TOUCH_SAMPLES; i++) tft.getTouchRaw(&xs[i], &ys[i]);
+        uint16_t tx = _median(xs, TOUCH_SAMPLES);
+        uint16_t ty = _median(ys, TOUCH_SAMPLES);
+        tft.convertRawXY(&tx, &ty);
+        if (tx < SCREEN_W && ty < SCREEN_H) {
+            data->point.x = tx;
+            data->point.y = ty;
+            data->state   = LV_INDEV_STATE_PRESSED;
+        }
+    }
+    _touching = data->state == LV_INDEV_STATE_PRESSED;
+    _touchStats.reads++;
+    _touchStats.spiUs += micros() - t0;
+}
+
+static void _readKeypad();
+
+static void _touchPoll(lv_timer_t*) {
+    if (_swallowTouch) {            // no conversions: PENIRQ is the pen
+        _penIrq       = false;
+        _swallowTouch = digitalRead(PIN_TOUCH_IRQ) == LOW;
+        return;
+    }
+    if (!_penDown() && !_touching) {
+        _touchStats.skipped++;
+        lv_timer_pause(_touchTimer);
+        return;
+    }
+    lv_timer_resume(_touchTimer);
+    bool was = _touching;
+    lv_indev_read(_touchIndev);
+    _penIrq = false;                // edges from our own conversions are not touches,
+    _irqUs  = 0;                    // nor wakes
+    ulTaskNotifyTake(pdTRUE, 0);
+    _readKeypad();                  // a button edge whose notification was just taken
+    if (was && !_touching) {
+        DBG("Touch: %lu reads (%lu us SPI), %lu idle reads skipped",
+            (unsigned long)_touchStats.reads, (unsigned long)_touchStats.spiUs,
+            (unsigned long)_touchStats.skipped);
     }
 }
 
-// Keypad (3 physical buttons) read callback
-static uint32_t _lastKey = 0;
+// Keypad (3 physical buttons): event mode, read only after a button edge
+static lv_indev_t* _keypadIndev = nullptr;
+static uint32_t    _lastKey     = 0;
+
+static void _readKeypad() {
+    if (!_btnIrq) return;
+    _btnIrq = false;
+    lv_indev_read(_keypadIndev);
+}
 
 static void _lvgl_keypad_read_cb(lv_indev_t* indev, lv_indev_data_t* data) {
     BtnId btn = hw_readButtons();
@@ -263,28 +424,33 @@ static const uint8_t REG_VBAT_ADC     = 0x0E;  // VBAT ADC result
 // Internal state
 static BatteryInfo _batt;
 
-// Simple I2C helpers
+// I2C helpers. The bus is shared with the PN532, which the NFC task drives on
+// core 0 while _pollPower runs on the render task (core 1), and Wire is one
+// object with one set of buffers: its HAL lock covers beginTransmission() to
+// endTransmission() and each requestFrom(), but not the Wire.read() after it,
+// so a PN532 read in between would hand us its byte. These go one level down
+// instead: each call is a single bus transaction on our own buffers, and the
+// IDF driver's command lock orders it against Wire's traffic. Bus 0 is Wire.
+#define BQ_I2C_BUS          0
+#define BQ_I2C_TIMEOUT_MS   20
+
 static bool _bq_write(uint8_t reg, uint8_t val) {
-    Wire.beginTransmission(BQ_ADDR);
-    Wire.write(reg);
-    Wire.write(val);
-    return Wire.endTransmission() == 0;
+    uint8_t buf[2] = {reg, val};
+    return i2cWrite(BQ_I2C_BUS, BQ_ADDR, buf, sizeof(buf), BQ_I2C_TIMEOUT_MS) == ESP_OK;
 }
 
 static bool _bq_read(uint8_t reg, uint8_t& val) {
-    Wire.beginTransmission(BQ_ADDR);
-    Wire.write(reg);
-    if (Wire.endTransmission(false) != 0) return false;   // repeated start
-    if (Wire.requestFrom((int)BQ_ADDR, 1) != 1) return false;
-    val = Wire.read();
-    return true;
+    size_t n = 0;                                           // repeated start
+    return i2cWriteReadNonStop(BQ_I2C_BUS, BQ_ADDR, &reg, 1, &val, 1, BQ_I2C_TIMEOUT_MS, &n) == ESP_OK
+        && n == 1;
 }
 
 // Configure charger: set fast-charge current ~1A and enable ADC
 void hw_initPower() {
     _batt = BatteryInfo{};
 
-    // Ensure Wire is running on the shared I2C bus; nfc_init() also calls Wire.begin
+    // Ensure the shared bus is up (Wire sets up the driver the helpers use);
+    // nfc_init() also calls Wire.begin
     Wire.begin(PIN_NFC_SDA, PIN_NFC_SCL);
 
     uint8_t v;
@@ -292,7 +458,6 @@ void hw_initPower() {
         DBG_PRINT("BQ25895 not responding");
         return;
     }
-    _batt.present = true;
 
     // Set ICHG to ~1.0A (REG04[5:0], 64mA steps, offset 512mA -> code 0x08 ≈1.0A)
     if (_bq_read(REG_ICHG, v)) {
@@ -306,16 +471,18 @@ void hw_initPower() {
         _bq_write(REG_CONV, v);
     }
 
+    // Last: hw_updatePower() starts polling once this is set, and this may
+    // run on the boot task
+    _batt.present = true;
     DBG_PRINT("BQ25895 init OK (ICHG≈1A, ADC on)");
 }
 
-// Poll charger for status + voltage
-void hw_updatePower() {
-    if (!_batt.present) return;
-    static uint32_t last = 0;
+// Poll charger for status + voltage, then again every POWER_POLL_MS
+static tw_id_t _powerTimer = TW_NONE;
+
+static void _pollPower(void*) {
+    _powerTimer = tw_start(POWER_POLL_MS, _pollPower, nullptr);
     uint32_t now = millis();
-    if (now - last < 1200) return; // light polling (~1.2s)
-    last = now;
 
     uint8_t st;
     if (_bq_read(REG_SYS_STATUS, st)) {
@@ -338,6 +505,11 @@ void hw_updatePower() {
     _batt.lastUpdateMs = now;
 }
 
+// Starts the polling once the boot task has found the charger
+void hw_updatePower() {
+    if (_batt.present && _powerTimer == TW_NONE) _pollPower(nullptr);
+}
+
 BatteryInfo hw_getBatteryInfo() { return _batt; }
 
 void hw_lvgl_init() {
@@ -348,25 +520,140 @@ void hw_lvgl_init() {
 
     // --- Display driver ---
     lv_display_t* disp = lv_display_create(SCREEN_W, SCREEN_H);
-    lv_display_set_buffers(disp, _lvBuf, NULL, sizeof(_lvBuf),
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, _lvBuf[0], _lvBuf[1], sizeof(_lvBuf[0]),
                            LV_DISPLAY_RENDER_MODE_PARTIAL);
     lv_display_set_flush_cb(disp, _lvgl_flush_cb);
-    DBG("LVGL display: %dx%d, buf=%u bytes", SCREEN_W, SCREEN_H, (unsigned)sizeof(_lvBuf));
+    lv_display_set_flush_wait_cb(disp, _lvgl_flush_wait_cb);
+    DBG("LVGL display: %dx%d, 2 x %u byte DMA buffers", SCREEN_W, SCREEN_H, (unsigned)sizeof(_lvBuf[0]));
 
     // --- Touch input device ---
-    lv_indev_t* touch_indev = lv_indev_create();
-    lv_indev_set_type(touch_indev, LV_INDEV_TYPE_POINTER);
-    lv_indev_set_read_cb(touch_indev, _lvgl_touch_read_cb);
+    _touchIndev = lv_indev_create();
+    lv_indev_set_type(_touchIndev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(_touchIndev, _lvgl_touch_read_cb);
+    lv_indev_set_mode(_touchIndev, LV_INDEV_MODE_EVENT);
+    _touchTimer = lv_timer_create(_touchPoll, TOUCH_POLL_MS, nullptr);
 
     // --- Keypad input device (3 buttons) ---
-    lv_indev_t* keypad_indev = lv_indev_create();
-    lv_indev_set_type(keypad_indev, LV_INDEV_TYPE_KEYPAD);
-    lv_indev_set_read_cb(keypad_indev, _lvgl_keypad_read_cb);
+    _keypadIndev = lv_indev_create();
+    lv_indev_set_type(_keypadIndev, LV_INDEV_TYPE_KEYPAD);
+    lv_indev_set_read_cb(_keypadIndev, _lvgl_keypad_read_cb);
+    lv_indev_set_mode(_keypadIndev, LV_INDEV_MODE_EVENT);
 
     // --- Default group for button navigation ---
     _defaultGroup = lv_group_create();
     lv_group_set_default(_defaultGroup);
-    lv_indev_set_group(keypad_indev, _defaultGroup);
+    lv_indev_set_group(_keypadIndev, _defaultGroup);
 
     DBG_PRINT("LVGL init done");
 }
+
+// =============================================================================
+// SLEEP  (tickless render loop, backlight dimming)
+// =============================================================================
+// Edges as attached in hw_initButtons/hw_initTouch; the PN532 IRQ only wakes
+static const WakePin _wakePins[] = {{PIN_BTN_LEFT,   GPIO_INTR_ANYEDGE},
+                                    {PIN_BTN_CENTER, GPIO_INTR_ANYEDGE},
+                                    {PIN_BTN_RIGHT,  GPIO_INTR_ANYEDGE},
+                                    {PIN_TOUCH_IRQ,  GPIO_INTR_NEGEDGE},
+                                    {PIN_NFC_IRQ,    GPIO_INTR_DISABLE}};
+static PowerStats _pwr;
+static PowerHook  _powerHook = nullptr;
+static uint32_t   _lastIdleMs = 0;     // last return from hw_idle()
+static uint32_t   _wakeUs     = 0;     // input being answered; timed to its first frame
+
+void hw_initSleep() {
+    _wakeTask   = xTaskGetCurrentTaskHandle();
+    _lastIdleMs = millis();
+}
+
+void hw_setPowerHook(PowerHook hook) { _powerHook = hook; }
+
+PowerStats hw_powerStats() {
+    _blAccount(millis());
+    PowerStats s = _pwr;
+    uint32_t total = s.runMs + s.waitMs + s.sleepMs;
+    if (total) {
+        s.avgMa = ((float)s.runMs   * POWER_MA_RUN +
+                   (float)s.waitMs  * POWER_MA_WAIT +
+                   (float)s.sleepMs * POWER_MA_SLEEP +
+                   (float)_blLevelMs * POWER_MA_BACKLIGHT / BL_FULL) / total;
+    }
+    return s;
+}
+
+// First frame after an input: the wake has been answered
+static void _wakeAnswered() {
+    if (!_wakeUs) return;
+    uint32_t us = micros() - _wakeUs;
+    _wakeUs = 0;
+    if (us > WAKE_RESPONSE_MS * 1000UL) return;     // nothing on screen changed
+    _pwr.wakes++;
+    _pwr.wakeUs = us;
+    if (us > _pwr.maxWakeUs) _pwr.maxWakeUs = us;
+    if (_powerHook) _powerHook(hw_powerStats());
+}
+
+// Read the inputs now rather than at their next poll, so a press is handled
+// in the pass it woke. On a dark screen the press only turns it back on:
+// nobody saw what it would have hit.
+static void _onInputWake(uint32_t irqUs) {
+    _irqUs = 0;
+    if (!_blLevel) {
+        lv_display_trigger_activity(nullptr);
+        hw_setBacklight(BL_FULL);
+        _swallowButtons();
+        _swallowTouch = _penDown();
+        if (_swallowTouch) lv_timer_resume(_touchTimer);
+        return;
+    }
+    _wakeUs = irqUs ? irqUs : micros();
+    _readKeypad();
+    _touchPoll(nullptr);
+}
+
+static void _updateBacklight() {
+    uint32_t quiet = lv_display_get_inactive_time(nullptr);
+    uint8_t  want  = quiet >= SLEEP_AFTER_MS ? 0 : quiet >= DIM_AFTER_MS ? BL_DIM : BL_FULL;
+    if (want != _blLevel) {
+        DBG("Backlight %u after %lu ms idle", want, (unsigned long)quiet);
+        hw_setBacklight(want);
+    }
+}
+
+// Light sleep stalls both cores and stops LEDC, so only with the screen dark
+// and no tone, transfer, card job or held input in flight
+static bool _canLightSleep() {
+    if (_blLevel || _melody || _touching || tft.dmaBusy() || nfc_busy()) return false;
+    return wakePinsIdle(_wakePins);
+}
+
+// LVGL's timers wait for the screen to come back; only the wheel (charger
+// polls) and the wake pins end the sleep
+static void _lightSleep(uint32_t wheelMs) {
+    uint32_t slept = 0;
+    bool byPin = lightSleepUntil(_wakePins, wheelMs, slept);
+    _pwr.sleepMs += slept;
+    _pwr.sleeps++;
+    if (byPin) _onInputWake(0);                    // the screen comes back on
+}
+
+void hw_idle(uint32_t lvglMs) {
+    uint32_t now = millis();
+    _pwr.runMs += now - _lastIdleMs;
+    _updateBacklight();
+
+    uint32_t wheel = tw_msUntilNext(now);
+    if (_woken) {
+        _woken = false;                             // an NFC result is waiting
+    } else if (_canLightSleep()) {
+        _lightSleep(wheel);
+    } else {
+        uint32_t   ms    = lvglMs < wheel ? lvglMs : wheel;
+        TickType_t ticks = ms == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(ms ? ms : 1);
+        if (ulTaskNotifyTake(pdTRUE, ticks) && _irqUs) _onInputWake(_irqUs);
+        _woken = false;
+        _pwr.waitMs += millis() - now;
+    }
+    _lastIdleMs = millis();
+}
@@ -17,7 +17,7 @@ struct BatteryInfo {
 };
 
 void        hw_initPower();          // Configure charger (1A) + start ADC
-void        hw_updatePower();        // Poll VBAT/CHG status (lightweight)
+void        hw_updatePower();        // Arms the VBAT/CHG poll timer once the charger is up
 BatteryInfo hw_getBatteryInfo();
 
 // =============================================================================
@@ -27,12 +27,47 @@ extern TFT_eSPI tft;
 
 void     hw_initDisplay();
 void     hw_backlight(bool on);
+void     hw_setBacklight(uint8_t level);   // 0-BL_FULL, PWM on BL_LEDC_CH
 
 // =============================================================================
 // LVGL DRIVERS  (display flush + touch + keypad)
 // =============================================================================
 void     hw_lvgl_init();           // Call AFTER hw_initDisplay + hw_initTouch + hw_initButtons
 
+struct DisplayStats {
+    uint32_t frames  = 0;          // refreshes fully pushed (last area flushed)
+    uint32_t flushes = 0;          // areas sent by DMA
+    uint32_t waitUs  = 0;          // time LVGL waited on a busy transfer
+};
+
+DisplayStats hw_displayStats();
+
+// =============================================================================
+// SLEEP  (tickless render loop, backlight dimming)
+// =============================================================================
+// The render task blocks until LVGL's next timer or the wheel's next
+// deadline; button and PENIRQ interrupts wake it early. After DIM_AFTER_MS
+// without input the backlight dims, after SLEEP_AFTER_MS it goes off and the
+// chip light-sleeps between wheel deadlines, woken by the same pins.
+struct PowerStats {
+    uint32_t runMs     = 0;        // render task busy
+    uint32_t waitMs    = 0;        // blocked until a deadline or an input
+    uint32_t sleepMs   = 0;        // in light sleep
+    uint32_t sleeps    = 0;
+    uint32_t wakes     = 0;        // input wakes timed to a frame
+    uint32_t wakeUs    = 0;        // last one: input to the end of its first frame
+    uint32_t maxWakeUs = 0;
+    float    avgMa     = 0.0f;     // estimate from the POWER_MA_* model
+};
+
+typedef void (*PowerHook)(const PowerStats& stats);
+
+void       hw_initSleep();                 // on the render task, which the inputs wake
+void       hw_idle(uint32_t lvglMs);       // lv_timer_handler()'s result
+void       hw_wake();                      // any task: end the render task's hw_idle()
+PowerStats hw_powerStats();
+void       hw_setPowerHook(PowerHook hook);   // after every timed wake
+
 // =============================================================================
 // TOUCH
 // =============================================================================
@@ -41,8 +76,15 @@ struct TouchPoint {
     bool    pressed = false;
 };
 
+struct TouchStats {
+    uint32_t reads   = 0;          // indev reads that went to the XPT2046
+    uint32_t skipped = 0;          // polls with PENIRQ high: no SPI at all
+    uint32_t spiUs   = 0;          // time spent in those reads
+};
+
 void       hw_initTouch();
 TouchPoint hw_getTouch();
+TouchStats hw_touchStats();
 bool       hw_touchInRect(int16_t tx, int16_t ty,
                           int16_t rx, int16_t ry, int16_t rw, int16_t rh);
 
@@ -61,7 +103,6 @@ bool  hw_isBtnHeld(BtnId b, uint32_t ms);      // true while held >= ms
 struct Note { uint16_t freq; uint16_t durationMs; };
 
 void hw_initAudio();
-void hw_updateAudio();                          // call every loop iteration
 void hw_setVolume(uint8_t vol);                 // 0-5 (0 = mute)
 void hw_playMelody(const Note* melody, uint8_t len);
 
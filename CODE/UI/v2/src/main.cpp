@@ -9,55 +9,109 @@
 #include "game_logic.h"
 #include "storage.h"
 #include "ui.h"
+#include "boot_trace.h"
+#include "timer_wheel.h"
+#if BATCH_BENCH
+  #include "game_batch.h"
+#endif
+
+// PN532 and BQ25895 share the I2C bus, so they come up one after the other
+// on the boot task while the display and LVGL start here. Afterwards the NFC
+// task owns the PN532 and the render task polls the charger; see the I2C
+// helpers in hardware.cpp for why that needs no lock of ours.
+static void _bootI2c() {
+    if (nfc_init()) {
+        Serial.println(F("[INIT] NFC ready"));
+    } else {
+        Serial.println(F("[INIT] NFC not detected — continuing without NFC"));
+    }
+    nfc_startTask();
+    boot_mark("nfc");
+    hw_initPower();
+}
+
+#if DEBUG
+static void _logWake(const PowerStats& p) {
+    DBG("Wake: %lu us to frame (max %lu), run %lu / wait %lu / sleep %lu ms, ~%.1f mA",
+        (unsigned long)p.wakeUs, (unsigned long)p.maxWakeUs, (unsigned long)p.runMs,
+        (unsigned long)p.waitMs, (unsigned long)p.sleepMs, p.avgMa);
+}
+#endif
+
+// Everything that touches LVGL, the UI or the engine runs here; card I/O
+// reaches it through nfc_takeResult() in ui_update()
+static void _render(void*) {
+    hw_initSleep();             // button / touch interrupts wake this task
+    for (;;) {
+        tw_run(millis());       // note ends, charger polls
+        hw_updatePower();       // starts polling once the charger is up
+        ui_update();            // NFC results, game state changes
+        uint32_t idle = lv_timer_handler();     // LVGL rendering + event processing
+        hw_idle(idle);          // until that, a wheel deadline, an input or a card
+    }
+}
 
 void setup() {
     Serial.begin(115200);
-    delay(200);
     Serial.println(F("\n=== Monopoly Electronic V2 ==="));
+    boot_mark("serial");
 
     // Seed RNG
     randomSeed(analogRead(0) ^ (millis() << 8));
 
+    // NFC (non-blocking — game works without it) + power / charger (BQ25895)
+    boot_spawn("charger", _bootI2c);
+
     // Hardware init
     hw_initDisplay();
+    boot_mark("display");
     hw_initTouch();
     hw_initButtons();
     hw_initAudio();
+    boot_mark("inputs");
 
     // LVGL framework (must be after display + touch + buttons)
     hw_lvgl_init();
-
-    // NFC (non-blocking — game works without it)
-    if (nfc_init()) {
-        Serial.println(F("[INIT] NFC ready"));
-    } else {
-        Serial.println(F("[INIT] NFC not detected — continuing without NFC"));
-    }
-
-    // Power / charger (BQ25895)
-    hw_initPower();
+    boot_mark("lvgl");
 
     // Load saved settings (if any)
     storage_loadSettings(G.settings);
     hw_setVolume(G.settings.volume);
+#if DEBUG
+    hw_setPowerHook(_logWake);
+#endif
 
     // Init game state
     game_init();
     G.phase = PHASE_SPLASH;
+    boot_mark("settings");
+
+#if BATCH_BENCH
+    // Bulk-simulation check: batch engine must match the scalar rules
+    batch_verify(4, 200, 12345);
+    batch_benchmark(4, 200);
+#endif
+
+    // Card results end the render task's idle wait, like an input
+    nfc_setWakeHook(hw_wake);
 
     // Init UI (LVGL screens)
     ui_init();
+    ui_update();            // build the splash and push it now
+    lv_timer_handler();
+    boot_mark("first frame");
 
     // Startup jingle
     hw_playJingle();
 
+    // LVGL belongs to the render task from here on
+    xTaskCreatePinnedToCore(_render, "render", RENDER_TASK_STACK, nullptr,
+                            RENDER_TASK_PRIO, nullptr, RENDER_TASK_CORE);
+
     Serial.println(F("[INIT] Ready"));
 }
 
 void loop() {
-    hw_updateAudio();       // advance non-blocking melodies
-    hw_updatePower();       // poll charger / battery state
-    ui_update();            // react to game state changes
-    lv_timer_handler();     // LVGL rendering + event processing
-    delay(5);               // yield
+    boot_report();          // once the boot task is done
+    delay(100);
 }
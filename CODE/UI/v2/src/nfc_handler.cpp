@@ -1,10 +1,11 @@
 #include "nfc_handler.h"
+#include "spsc_queue.h"
 
 // =============================================================================
 // PN532 instance (I2C)
 // =============================================================================
 static Adafruit_PN532 _nfc(PIN_NFC_IRQ, PIN_NFC_RST);
-static bool _nfcOk = false;
+static volatile bool _nfcOk = false;   // set last: nfc_init() may run on the boot task
 
 // Mifare Classic default key
 static const uint8_t MIFARE_KEY[6] = {0xFF,0xFF,0xFF,0xFF,0xFF,0xFF};
@@ -171,3 +172,105 @@ bool nfc_writeEventCard(uint8_t* uid, uint8_t uidLen, const NfcEventCard& data)
     if (!_writeBlock(uid, uidLen, DATA_BLOCK_1, b1)) return false;
     return true;
 }
+
+// =============================================================================
+// NFC TASK
+// =============================================================================
+struct _NfcRequest {
+    NfcJob  job;
+    uint8_t seq;
+    union {
+        NfcPlayerCard   player;
+        NfcPropertyCard property;
+        NfcEventCard    event;
+    };
+};
+
+static SpscQueue<_NfcRequest, 4> _requests;     // render task -> NFC task
+static SpscQueue<NfcResult, 4>   _results;      // NFC task -> render task
+static TaskHandle_t volatile _nfcTask = nullptr;   // set by the boot task
+static uint8_t      _seq     = 0;
+static std::atomic<bool> _busy{false};         // a job other than NFC_JOB_IDLE
+static NfcWakeHook volatile _wakeHook = nullptr;   // the consumer of _results
+
+// Runs the newest job; sleeps until one arrives while idle
+static void _nfcLoop(void*) {
+    _NfcRequest cur = {};
+    _NfcRequest next;
+    for (;;) {
+        while (_requests.pop(next)) cur = next;
+        _busy = cur.job != NFC_JOB_IDLE;
+        if (cur.job == NFC_JOB_IDLE) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        NfcResult r = {};
+        r.seq = cur.seq;
+        if (nfc_pollCard(r.uid, &r.uidLen, NFC_POLL_TIMEOUT_MS)) {
+            switch (cur.job) {
+                case NFC_JOB_READ_PLAYER:
+                    r.ok = nfc_readPlayerCard(r.uid, r.uidLen, r.player);
+                    break;
+                case NFC_JOB_WRITE_PLAYER:
+                    r.ok = nfc_writePlayerCard(r.uid, r.uidLen, cur.player);
+                    break;
+                case NFC_JOB_WRITE_PROPERTY:
+                    r.ok = nfc_writePropertyCard(r.uid, r.uidLen, cur.property);
+                    break;
+                case NFC_JOB_WRITE_EVENT:
+                    r.ok = nfc_writeEventCard(r.uid, r.uidLen, cur.event);
+                    break;
+                default:
+                    break;
+            }
+            if (cur.job != NFC_JOB_READ_PLAYER) cur.job = NFC_JOB_IDLE;
+            if (!_results.push(r)) {
+                DBG_PRINT("NFC result dropped (queue full)");
+            } else {
+                NfcWakeHook wake = _wakeHook;
+                if (wake) wake();
+            }
+        }
+        // Poll rhythm as before; a new job cuts the wait short
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(NFC_POLL_INTERVAL_MS));
+    }
+}
+
+bool nfc_startTask() {
+    if (!_nfcOk || _nfcTask) return _nfcTask != nullptr;
+    TaskHandle_t t = nullptr;
+    if (xTaskCreatePinnedToCore(_nfcLoop, "nfc", NFC_TASK_STACK, nullptr,
+                                NFC_TASK_PRIO, &t, NFC_TASK_CORE) != pdPASS) {
+        Serial.println(F("[NFC] task not started"));
+        return false;
+    }
+    _nfcTask = t;
+    return true;
+}
+
+uint8_t nfc_post(NfcJob job, const void* card) {
+    if (!_nfcTask) return 0;
+    _NfcRequest req = {};
+    req.job = job;
+    if (++_seq == 0) _seq = 1;
+    req.seq = _seq;
+    switch (job) {
+        case NFC_JOB_WRITE_PLAYER:   req.player   = *(const NfcPlayerCard*)card;   break;
+        case NFC_JOB_WRITE_PROPERTY: req.property = *(const NfcPropertyCard*)card; break;
+        case NFC_JOB_WRITE_EVENT:    req.event    = *(const NfcEventCard*)card;    break;
+        default: break;
+    }
+    if (!_requests.push(req)) return 0;
+    if (job != NFC_JOB_IDLE) _busy = true;      // until the task has it
+    xTaskNotifyGive(_nfcTask);
+    return req.seq;
+}
+
+bool nfc_takeResult(NfcResult& out) {
+    return _results.pop(out);
+}
+
+bool nfc_busy() { return _busy; }
+
+void nfc_setWakeHook(NfcWakeHook hook) { _wakeHook = hook; }
@@ -47,3 +47,36 @@ bool    nfc_readEventCard(uint8_t* uid, uint8_t uidLen, NfcEventCard& out);
 bool    nfc_writePlayerCard(uint8_t* uid, uint8_t uidLen, const NfcPlayerCard& data);
 bool    nfc_writePropertyCard(uint8_t* uid, uint8_t uidLen, const NfcPropertyCard& data);
 bool    nfc_writeEventCard(uint8_t* uid, uint8_t uidLen, const NfcEventCard& data);
+
+// =============================================================================
+// NFC TASK  (card I/O off the render task)
+// =============================================================================
+// After nfc_init() the PN532 belongs to a task on NFC_TASK_CORE. The render
+// task posts one job at a time and collects results; both directions are
+// lock-free rings, so a 100 ms detect never holds up a frame. A new job
+// replaces the running one; results carry the seq of the job they answer.
+// The render task may sleep with no deadline, so every result pushed runs
+// the wake hook (hw_wake) after it.
+enum NfcJob : uint8_t {
+    NFC_JOB_IDLE = 0,           // stop polling
+    NFC_JOB_READ_PLAYER,        // report every player card presented
+    NFC_JOB_WRITE_PLAYER,       // write the first card presented, then idle
+    NFC_JOB_WRITE_PROPERTY,
+    NFC_JOB_WRITE_EVENT,
+};
+
+struct NfcResult {
+    uint8_t       seq;          // job this answers
+    bool          ok;           // card read / written
+    uint8_t       uid[7];
+    uint8_t       uidLen;
+    NfcPlayerCard player;       // NFC_JOB_READ_PLAYER
+};
+
+bool    nfc_startTask();                            // false without a reader
+uint8_t nfc_post(NfcJob job, const void* card = nullptr);  // card matches job; 0 = not queued
+bool    nfc_takeResult(NfcResult& out);             // render task only
+bool    nfc_busy();                                 // a job is running (no light sleep)
+
+typedef void (*NfcWakeHook)();
+void    nfc_setWakeHook(NfcWakeHook hook);          // before the first nfc_post()
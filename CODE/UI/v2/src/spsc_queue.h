@@ -0,0 +1,36 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+// =============================================================================
+// SPSC QUEUE  (one producer task, one consumer task, no locks)
+// =============================================================================
+// Each index is written by one side only; the release / acquire pair makes
+// the slot contents visible before the index that publishes them. N must be
+// a power of two no larger than 128 so the 8-bit indices wrap cleanly.
+template <class T, uint8_t N>
+class SpscQueue {
+    static_assert(N && (N & (N - 1)) == 0 && N <= 128, "N must be a power of two <= 128");
+
+public:
+    bool push(const T& item) {                      // producer; false when full
+        uint8_t head = _head.load(std::memory_order_relaxed);
+        if ((uint8_t)(head - _tail.load(std::memory_order_acquire)) == N) return false;
+        _items[head & (N - 1)] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& out) {                              // consumer; false when empty
+        uint8_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) return false;
+        out = _items[tail & (N - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T _items[N];
+    std::atomic<uint8_t> _head{0};
+    std::atomic<uint8_t> _tail{0};
+};
@@ -1,6 +1,7 @@
 #include "storage.h"
 #include <Preferences.h>
 #include "config.h"
+#include "game_stats.h"
 
 static Preferences prefs;
 
@@ -86,6 +87,9 @@ bool storage_loadGame() {
     prefs.getBytes("settings", &G.settings,      sizeof(GameSettings));
 
     prefs.end();
+    game_rehash();
+    game_recomputeStandings();
+    stats_reset(G.numPlayers);     // stats are not saved; don't inherit the last game's
     G.phase = PHASE_TURN_START;
     G.screenDirty = true;
     DBG("storage_loadGame: loaded %d players, turn %d", G.numPlayers, G.turnNumber);
@@ -0,0 +1,14 @@
+#include "timer_wheel.h"
+#include <TimerWheel.h>         // CODE/lib, shared with esp32Code
+
+static BasicTimerWheel<TW_MAX_TIMERS> _wheel;
+static_assert(decltype(_wheel)::TICK_MS == TW_TICK_MS, "TW_TICK_MS must match the wheel");
+
+tw_id_t tw_start(uint32_t delayMs, void (*cb)(void*), void* ctx) {
+    return _wheel.start(delayMs, cb, ctx);
+}
+
+bool     tw_pending(tw_id_t id)            { return _wheel.pending(id); }
+void     tw_cancel(tw_id_t& id)            { _wheel.cancel(id); }
+void     tw_run(uint32_t nowMs)            { _wheel.run(nowMs); }
+uint32_t tw_msUntilNext(uint32_t nowMs)    { return _wheel.msUntilNext(nowMs); }
@@ -0,0 +1,25 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// =============================================================================
+// TIMER WHEEL  (deadlines outside LVGL: note ends, charger polling)
+// =============================================================================
+// C front end for the shared BasicTimerWheel (CODE/lib/TimerWheel): three
+// wheels of 64 slots at TW_TICK_MS, O(1) tw_start() and tw_cancel(), and
+// tw_run() only touches timers that are due or cascading. Loop core only;
+// screen timers stay lv_timer.
+
+#ifndef TW_MAX_TIMERS
+  #define TW_MAX_TIMERS      8
+#endif
+#define TW_TICK_MS           10
+#define TW_NONE              0
+
+typedef uint16_t tw_id_t;                          // slot | generation << 8
+
+tw_id_t  tw_start(uint32_t delayMs, void (*cb)(void*), void* ctx);  // TW_NONE = pool full
+void     tw_cancel(tw_id_t& id);                   // clears id; no-op once fired
+bool     tw_pending(tw_id_t id);
+void     tw_run(uint32_t nowMs);                   // fire everything due
+uint32_t tw_msUntilNext(uint32_t nowMs);           // UINT32_MAX when idle
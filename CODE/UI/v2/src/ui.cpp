@@ -5,7 +5,9 @@
 #include "hardware.h"
 #include "nfc_handler.h"
 #include "storage.h"
+#include "game_stats.h"
 #include "config.h"
+#include "ui_theme.h"
 #include <lvgl.h>
 
 // =============================================================================
@@ -35,24 +37,6 @@ static lv_color_t _c(uint16_t rgb565) {
     return lv_color_make(r, g, b);
 }
 
-// Theme colours as lv_color_t
-static lv_color_t C_BG, C_BG_DARK, C_PRIMARY, C_ACCENT, C_TEXT, C_TEXT_DIM;
-static lv_color_t C_BTN_BG, C_BTN_ACTIVE, C_DANGER, C_WARN, C_HEADER;
-
-static void _initColors() {
-    C_BG         = lv_color_hex(0x000000);
-    C_BG_DARK    = lv_color_hex(0x101018);
-    C_PRIMARY    = lv_color_hex(0x00643C);
-    C_ACCENT     = lv_color_hex(0xFFC800);
-    C_TEXT       = lv_color_hex(0xFFFFFF);
-    C_TEXT_DIM   = lv_color_hex(0x7B7B7B);
-    C_BTN_BG    = lv_color_hex(0x282832);
-    C_BTN_ACTIVE = lv_color_hex(0x00B450);
-    C_DANGER     = lv_color_hex(0xDC2828);
-    C_WARN       = lv_color_hex(0xF0B400);
-    C_HEADER     = lv_color_hex(0x141423);
-}
-
 static lv_color_t _playerColor(uint8_t idx) {
     return _c(PLAYER_COLOURS[idx % MAX_PLAYERS]);
 }
@@ -78,9 +62,20 @@ static uint8_t   _usedTokens   = 0;  // Bitmask of already-written tokens
 static lv_timer_t* _activeTimer  = nullptr;
 static lv_timer_t* _activeTimer2 = nullptr;
 
+// Card job of the shown screen: results for any other seq are stale
+typedef void (*_NfcFn)(const NfcResult& r);
+static uint8_t _nfcSeq     = 0;
+static _NfcFn  _nfcHandler = nullptr;
+
+static void _nfcJob(NfcJob job, const void* card, _NfcFn handler) {
+    _nfcSeq     = nfc_post(job, card);
+    _nfcHandler = _nfcSeq ? handler : nullptr;
+}
+
 static void _clearTimers() {
     if (_activeTimer)  { lv_timer_delete(_activeTimer);  _activeTimer  = nullptr; }
     if (_activeTimer2) { lv_timer_delete(_activeTimer2); _activeTimer2 = nullptr; }
+    if (_nfcHandler)   { nfc_post(NFC_JOB_IDLE); _nfcHandler = nullptr; }
 }
 
 // =============================================================================
@@ -145,8 +140,7 @@ static void _initStatusOverlay() {
     // Charging bolt indicator (initially hidden)
     _battBolt = lv_label_create(_statusCont);
     lv_label_set_text(_battBolt, LV_SYMBOL_CHARGE);
-    lv_obj_set_style_text_color(_battBolt, C_TEXT, 0);
-    lv_obj_set_style_text_font(_battBolt, FONT_SM, 0);
+    theme_text(_battBolt, FONT_SM, C_TEXT);
     lv_obj_set_pos(_battBolt, 12, 4);
     lv_obj_add_flag(_battBolt, LV_OBJ_FLAG_HIDDEN);
 }
@@ -196,25 +190,156 @@ static void _refreshStatusOverlay() {
     }
 }
 
+// =============================================================================
+// SCREEN POOL
+// =============================================================================
+// The screens of every turn (turn start, rolling, tile action) are built once
+// per variant and kept while hidden; entering one again runs its refresh,
+// which only touches widgets whose value changed. The least recently shown is
+// deleted when the slots run out or the LVGL heap in use passes
+// UI_POOL_BUDGET. Other screens are built on entry and deleted when the next
+// one is shown. UI_POOL_SLOTS=0 builds every screen on entry (the baseline
+// for the switch-time / fragmentation figures in ui_poolStats()).
+#ifndef UI_POOL_SLOTS
+  #define UI_POOL_SLOTS    4
+#endif
+#ifndef UI_POOL_BUDGET
+  #define UI_POOL_BUDGET   (LV_MEM_SIZE * 3 / 4)   // heap in use before idle screens go
+#endif
+#define UI_POOL_WIDGETS    24
+#define _POOL_KEY(phase, variant)  (uint16_t)(((phase) << 8) | (variant))
+
+struct _Pooled {
+    lv_obj_t* scr;
+    uint16_t  key;                   // _POOL_KEY(phase, variant)
+    uint32_t  shown;                 // _poolClock at last use (LRU)
+    uint32_t  bytes;                 // LVGL heap the build took
+    lv_obj_t* w[UI_POOL_WIDGETS];    // widgets the screen's refresh updates
+};
+typedef lv_obj_t* (*_CreateFn)(lv_obj_t** w);
+
+static _Pooled     _pool[UI_POOL_SLOTS > 0 ? UI_POOL_SLOTS : 1];
+static uint32_t    _poolClock = 0;
+static lv_obj_t*   _shownScr  = nullptr;
+static UiPoolStats _poolStats;
+static uint32_t    _heapLoaded = 0;   // heap with the new screen loaded, the old one not yet freed
+
+static void _heapMonitor(uint32_t& used, uint8_t& frag) {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    used = mon.total_size - mon.free_size;
+    frag = mon.frag_pct;
+}
+
+static uint32_t _heapUsed() {
+    uint32_t used; uint8_t frag;
+    _heapMonitor(used, frag);
+    return used;
+}
+
+static bool _isPooled(lv_obj_t* scr) {
+    for (uint8_t i = 0; i < UI_POOL_SLOTS; i++) {
+        if (scr && _pool[i].scr == scr) return true;
+    }
+    return false;
+}
+
+// Deletes the least recently used screen that is not on display
+static bool _poolEvict() {
+    _Pooled* lru = nullptr;
+    for (uint8_t i = 0; i < UI_POOL_SLOTS; i++) {
+        _Pooled& e = _pool[i];
+        if (!e.scr || e.scr == _shownScr) continue;
+        if (!lru || e.shown < lru->shown) lru = &e;
+    }
+    if (!lru) return false;
+    DBG("UI: pool evict %04x (%lu B)", lru->key, (unsigned long)lru->bytes);
+    lv_obj_delete(lru->scr);
+    lru->scr = nullptr;
+    _poolStats.evictions++;
+    return true;
+}
+
+// The screen for key with its widget handles, built by create() on a miss
+static _Pooled* _poolGet(uint16_t key, _CreateFn create) {
+#if UI_POOL_SLOTS == 0
+    static _Pooled scratch;
+    memset(&scratch, 0, sizeof(scratch));
+    scratch.scr = create(scratch.w);
+    _poolStats.builds++;
+    return &scratch;
+#else
+    _poolClock++;
+    _Pooled* slot = nullptr;
+    for (uint8_t i = 0; i < UI_POOL_SLOTS; i++) {
+        if (_pool[i].scr && _pool[i].key == key) {
+            _pool[i].shown = _poolClock;
+            _poolStats.hits++;
+            return &_pool[i];
+        }
+    }
+    while (_heapUsed() > UI_POOL_BUDGET && _poolEvict()) {}
+    for (uint8_t i = 0; i < UI_POOL_SLOTS && !slot; i++) {
+        if (!_pool[i].scr) slot = &_pool[i];
+    }
+    if (!slot) {
+        _poolEvict();
+        for (uint8_t i = 0; i < UI_POOL_SLOTS && !slot; i++) {
+            if (!_pool[i].scr) slot = &_pool[i];
+        }
+    }
+    // Every slot is on display (not possible with one screen shown)
+    if (!slot) slot = &_pool[0];
+
+    memset(slot, 0, sizeof(*slot));
+    uint32_t before = _heapUsed();
+    slot->scr   = create(slot->w);
+    slot->bytes = _heapUsed() - before;
+    slot->key   = key;
+    slot->shown = _poolClock;
+    _poolStats.builds++;
+    return slot;
+#endif
+}
+
+// Keypad focus: a hidden pooled screen's controls leave the default group
+// (marked USER_1) and rejoin it, in tree order, when it is shown again.
+static void _parkGroup(lv_obj_t* obj) {
+    if (lv_obj_get_group(obj)) {
+        lv_group_remove_obj(obj);
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_USER_1);
+    }
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) _parkGroup(lv_obj_get_child(obj, i));
+}
+
+static void _unparkGroup(lv_obj_t* obj) {
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_USER_1)) {
+        lv_obj_remove_flag(obj, LV_OBJ_FLAG_USER_1);
+        lv_group_add_obj(lv_group_get_default(), obj);
+    }
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) _unparkGroup(lv_obj_get_child(obj, i));
+}
+
+const UiPoolStats& ui_poolStats() { return _poolStats; }
+
 // =============================================================================
 // SCREEN MANAGEMENT
 // =============================================================================
 static void _showScreen(lv_obj_t* scr) {
     _clearTimers();
-    lv_screen_load_anim(scr, LV_SCR_LOAD_ANIM_NONE, 0, 0, true);
+    lv_obj_t* old = _shownScr;
+    if (old && old != scr && _isPooled(old)) _parkGroup(old);
+    if (old != scr && _isPooled(scr)) _unparkGroup(scr);
+    lv_screen_load_anim(scr, LV_SCR_LOAD_ANIM_NONE, 0, 0, false);
+    _shownScr = scr;
+    _heapLoaded = _heapUsed();
+    if (old && old != scr && !_isPooled(old)) lv_obj_delete(old);
 }
 
 static lv_obj_t* _newScreen() {
     lv_obj_t* scr = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(scr, C_BG, 0);
-    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
-    lv_obj_set_style_bg_grad_color(scr, C_BG_DARK, 0);
-    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
+    theme_screen(scr);
     lv_obj_set_scrollbar_mode(scr, LV_SCROLLBAR_MODE_OFF);
-    // Remove padding & theme artifacts (white border)
-    lv_obj_set_style_pad_all(scr, 0, 0);
-    lv_obj_set_style_border_width(scr, 0, 0);
-    lv_obj_set_style_outline_width(scr, 0, 0);
     lv_obj_clear_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
     return scr;
 }
@@ -227,15 +352,13 @@ static lv_obj_t* _mkHeader(lv_obj_t* parent, const char* text, lv_color_t bg) {
     lv_obj_remove_style_all(bar);
     lv_obj_set_size(bar, SCREEN_W, 28);
     lv_obj_align(bar, LV_ALIGN_TOP_MID, 0, 0);
+    theme_header(bar);
     lv_obj_set_style_bg_color(bar, bg, 0);
-    lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(bar, 1, 0);
     lv_obj_set_style_border_color(bar, lv_color_darken(bg, 32), 0);
 
     lv_obj_t* lbl = lv_label_create(bar);
     lv_label_set_text(lbl, text);
-    lv_obj_set_style_text_color(lbl, C_TEXT, 0);
-    lv_obj_set_style_text_font(lbl, FONT_MD, 0);
+    theme_text(lbl, FONT_MD, C_TEXT);
     lv_obj_center(lbl);
     return bar;
 }
@@ -248,29 +371,11 @@ static lv_obj_t* _mkBtn(lv_obj_t* parent, const char* text,
     lv_obj_set_size(btn, w, h);
     lv_obj_set_pos(btn, x, y);
 
-    // Default state
-    lv_obj_set_style_bg_color(btn, bg, 0);
-    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(btn, 10, 0);
-    lv_obj_set_style_shadow_width(btn, 8, 0);
-    lv_obj_set_style_shadow_opa(btn, LV_OPA_20, 0);
-    lv_obj_set_style_shadow_spread(btn, 1, 0);
-    lv_obj_set_style_border_width(btn, 2, 0);
-    lv_obj_set_style_border_color(btn, lv_color_darken(bg, 40), 0);
-    lv_obj_set_style_border_opa(btn, LV_OPA_COVER, 0);
-
-    // Pressed state — border-based (draws inside bounds, no clipping)
-    lv_obj_set_style_bg_color(btn, lv_color_lighten(bg, 40), LV_STATE_PRESSED);
-    lv_obj_set_style_border_color(btn, C_ACCENT, LV_STATE_PRESSED);
-    lv_obj_set_style_shadow_width(btn, 0, LV_STATE_PRESSED);
-
-    // Focused state (keypad navigation) — border-based, no outline clipping
-    lv_obj_set_style_border_color(btn, C_ACCENT, LV_STATE_FOCUSED);
+    theme_button(btn, bg);
 
     lv_obj_t* lbl = lv_label_create(btn);
     lv_label_set_text(lbl, text);
-    lv_obj_set_style_text_color(lbl, C_TEXT, 0);
-    lv_obj_set_style_text_font(lbl, FONT_MD, 0);
+    theme_text(lbl, FONT_MD, C_TEXT);
     lv_obj_center(lbl);
 
     if (cb) lv_obj_add_event_cb(btn, cb, LV_EVENT_CLICKED, ud);
@@ -284,24 +389,148 @@ static lv_obj_t* _mkLabel(lv_obj_t* parent, const char* text,
                             const lv_font_t* font, lv_color_t color) {
     lv_obj_t* lbl = lv_label_create(parent);
     lv_label_set_text(lbl, text);
-    lv_obj_set_style_text_color(lbl, color, 0);
-    lv_obj_set_style_text_font(lbl, font, 0);
+    theme_text(lbl, font, color);
     lv_obj_align(lbl, align, xofs, yofs);
     return lbl;
 }
 
-// Player mini bar (small info strip)
-static void _mkPlayerMini(lv_obj_t* parent, int16_t x, int16_t y, uint8_t idx) {
-    if (idx >= G.numPlayers) return;
-    const Player& p = G.players[idx];
+// Refresh setters: leave the widget (and its redraw) alone when unchanged
+static void _setText(lv_obj_t* lbl, const char* text) {
+    if (strcmp(lv_label_get_text(lbl), text) != 0) lv_label_set_text(lbl, text);
+}
+
+static void _setBg(lv_obj_t* obj, lv_color_t c) {
+    if (!lv_color_eq(lv_obj_get_style_bg_color(obj, 0), c)) lv_obj_set_style_bg_color(obj, c, 0);
+}
+
+static void _setBorder(lv_obj_t* obj, lv_color_t c) {
+    if (!lv_color_eq(lv_obj_get_style_border_color(obj, 0), c)) lv_obj_set_style_border_color(obj, c, 0);
+}
+
+static void _setShown(lv_obj_t* obj, bool shown) {
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) != shown) return;
+    if (shown) lv_obj_remove_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    else       lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void _setLabelStyle(lv_obj_t* lbl, const lv_font_t* font, lv_color_t color) {
+    if (lv_obj_get_style_text_font(lbl, 0) != font) lv_obj_set_style_text_font(lbl, font, 0);
+    if (!lv_color_eq(lv_obj_get_style_text_color(lbl, 0), color)) lv_obj_set_style_text_color(lbl, color, 0);
+}
+
+// Same colour scheme as theme_button(); local values override the shared style
+static void _setBtnColor(lv_obj_t* btn, lv_color_t bg) {
+    if (lv_color_eq(lv_obj_get_style_bg_color(btn, 0), bg)) return;
+    lv_obj_set_style_bg_color(btn, bg, 0);
+    lv_obj_set_style_border_color(btn, lv_color_darken(bg, 40), 0);
+    lv_obj_set_style_bg_color(btn, lv_color_lighten(bg, 40), LV_STATE_PRESSED);
+}
+
+// =============================================================================
+// BINDINGS
+// =============================================================================
+// Engine changes (game_setObserver) land on one int subject per GameChange
+// kind whose value is the player / tile that changed. A bound widget keeps
+// the index it shows as its user data and redraws only when that index
+// changes, so a rent payment rewrites the payer's and the owner's money
+// labels and nothing else. Pooled screens retarget their widgets on refresh;
+// the observers go away with the widget.
+#define BIND_ANY  0xFF                  // widget index: every change of the kind
+
+typedef void (*_BindFn)(lv_obj_t* obj, uint8_t idx);
+
+static lv_subject_t _subjects[GC_KINDS];
+
+static void _onGameChange(GameChange what, uint8_t idx) {
+    lv_subject_t* s = &_subjects[what];
+    // The same player paying twice in a row must still notify
+    if (lv_subject_get_int(s) == idx) lv_subject_notify(s);
+    else                              lv_subject_set_int(s, idx);
+}
+
+static void _onBound(lv_observer_t* o, lv_subject_t* s) {
+    lv_obj_t* obj = lv_observer_get_target_obj(o);
+    uint8_t idx = (uint8_t)(uintptr_t)lv_obj_get_user_data(obj);
+    if (idx == BIND_ANY || lv_subject_get_int(s) == idx) {
+        ((_BindFn)lv_observer_get_user_data(o))(obj, idx);
+    }
+}
+
+// Follow one kind of change for player / tile idx (BIND_ANY: all of them)
+static void _bind(lv_obj_t* obj, GameChange what, uint8_t idx, _BindFn fn) {
+    lv_obj_set_user_data(obj, (void*)(uintptr_t)idx);
+    lv_subject_add_observer_obj(&_subjects[what], _onBound, obj, (void*)fn);
+    fn(obj, idx);
+}
+
+// A pooled widget now shows another player / tile
+static void _rebind(lv_obj_t* obj, uint8_t idx, _BindFn fn) {
+    lv_obj_set_user_data(obj, (void*)(uintptr_t)idx);
+    fn(obj, idx);
+}
+
+static void _initBindings() {
+    for (uint8_t k = 0; k < GC_KINDS; k++) lv_subject_init_int(&_subjects[k], -1);
+    game_setObserver(_onGameChange);
+}
+
+// Bound redraws: idx is a player (money, position) or tile (owner, houses)
+static void _drawMoney(lv_obj_t* lbl, uint8_t idx) {
+    char buf[16]; snprintf(buf, sizeof(buf), "$%ld", (long)G.players[idx].money);
+    _setText(lbl, buf);
+}
+
+static void _drawNameMoney(lv_obj_t* lbl, uint8_t idx) {
+    char buf[24]; snprintf(buf, sizeof(buf), "%.8s $%ld", G.players[idx].name, (long)G.players[idx].money);
+    _setText(lbl, buf);
+}
+
+static void _drawPosition(lv_obj_t* lbl, uint8_t idx) {
+    uint8_t pos = G.players[idx].position;
+    char buf[40]; snprintf(buf, sizeof(buf), "Pos: %s (#%d)", TILES[pos].name, pos);
+    _setText(lbl, buf);
+}
+
+// Current player's standing: any balance, deed or building moves it
+static void _drawStanding(lv_obj_t* lbl, uint8_t) {
+    uint8_t cp = G.currentPlayer;
+    char buf[40];
+    snprintf(buf, sizeof(buf), "Rank %d/%d  Net $%ld", G.rank[cp] + 1, G.numPlayers, (long)G.netWorth[cp]);
+    _setText(lbl, buf);
+}
+
+static void _drawHouses(lv_obj_t* lbl, uint8_t tile) {
+    uint8_t h = G.props[tile].houses;
+    char buf[16]; snprintf(buf, sizeof(buf), h == 5 ? "HOTEL" : "Houses: %d", h);
+    _setText(lbl, buf);
+}
+
+static bool _canUpgrade(uint8_t tile) {
+    const TileData& td = TILES[tile];
+    return td.type == TILE_PROPERTY && G.props[tile].houses < MAX_HOUSES
+           && game_ownsFullGroup(G.currentPlayer, td.group);
+}
 
+static void _drawUpgradeCost(lv_obj_t* lbl, uint8_t tile) {
+    char buf[24]; snprintf(buf, sizeof(buf), "Upgrade: $%d", TILES[tile].houseCost);
+    _setText(lbl, buf);
+    _setShown(lbl, _canUpgrade(tile));
+}
+
+static void _drawUpgradeBtn(lv_obj_t* btn, uint8_t tile) {
+    _setShown(btn, _canUpgrade(tile));
+}
+
+// Player mini bar (small info strip): w gets the container, colour dot, name
+// and money; _setMini() fills them in
+enum { MINI_CONT, MINI_DOT, MINI_NAME, MINI_MONEY, MINI_WIDGETS };
+
+static void _mkMini(lv_obj_t* parent, int16_t x, int16_t y, lv_obj_t** w) {
     lv_obj_t* cont = lv_obj_create(parent);
     lv_obj_remove_style_all(cont);
     lv_obj_set_size(cont, 74, 24);
     lv_obj_set_pos(cont, x, y);
-    lv_obj_set_style_bg_color(cont, p.alive ? C_BG_DARK : lv_color_hex(0x3C1414), 0);
-    lv_obj_set_style_bg_opa(cont, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(cont, 3, 0);
+    theme_strip(cont);
     lv_obj_set_scrollbar_mode(cont, LV_SCROLLBAR_MODE_OFF);
 
     // Color dot
@@ -309,25 +538,34 @@ static void _mkPlayerMini(lv_obj_t* parent, int16_t x, int16_t y, uint8_t idx) {
     lv_obj_remove_style_all(dot);
     lv_obj_set_size(dot, 10, 10);
     lv_obj_set_pos(dot, 2, 7);
-    lv_obj_set_style_bg_color(dot, _c(p.colour), 0);
-    lv_obj_set_style_bg_opa(dot, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, 0);
+    theme_dot(dot);
 
     // Name
     lv_obj_t* nm = lv_label_create(cont);
-    char nb[8]; snprintf(nb, sizeof(nb), "%.5s", p.name);
-    lv_label_set_text(nm, nb);
-    lv_obj_set_style_text_color(nm, C_TEXT, 0);
-    lv_obj_set_style_text_font(nm, FONT_SM, 0);
+    lv_label_set_text(nm, "");
+    theme_text(nm, FONT_SM, C_TEXT);
     lv_obj_set_pos(nm, 14, 1);
 
     // Money
     lv_obj_t* mn = lv_label_create(cont);
-    char mb[12]; snprintf(mb, sizeof(mb), "$%ld", (long)p.money);
-    lv_label_set_text(mn, mb);
-    lv_obj_set_style_text_color(mn, C_ACCENT, 0);
-    lv_obj_set_style_text_font(mn, FONT_SM, 0);
+    lv_label_set_text(mn, "");
+    theme_text(mn, FONT_SM, C_ACCENT);
     lv_obj_set_pos(mn, 14, 13);
+    _bind(mn, GC_MONEY, 0, _drawMoney);
+
+    w[MINI_CONT]  = cont;
+    w[MINI_DOT]   = dot;
+    w[MINI_NAME]  = nm;
+    w[MINI_MONEY] = mn;
+}
+
+static void _setMini(lv_obj_t** w, uint8_t idx) {
+    const Player& p = G.players[idx];
+    _setBg(w[MINI_CONT], p.alive ? C_BG_DARK : lv_color_hex(0x3C1414));
+    _setBg(w[MINI_DOT], _c(p.colour));
+    char nb[8]; snprintf(nb, sizeof(nb), "%.5s", p.name);
+    _setText(w[MINI_NAME], nb);
+    _rebind(w[MINI_MONEY], idx, _drawMoney);
 }
 
 // =============================================================================
@@ -348,6 +586,7 @@ static void _buildQuickMenu();
 static void _buildProgramming();
 static void _buildSettings();
 static void _buildGameOver();
+static void _buildGameStats();
 
 // =============================================================================
 // SCREEN: SPLASH
@@ -513,14 +752,12 @@ static void _buildSetupPlayers() {
             lv_obj_t* nm = lv_label_create(slot);
             char nb[MAX_NAME_LEN+1]; snprintf(nb, sizeof(nb), "%s", G.players[i].name);
             lv_label_set_text(nm, nb);
-            lv_obj_set_style_text_color(nm, C_TEXT, 0);
-            lv_obj_set_style_text_font(nm, FONT_SM, 0);
+            theme_text(nm, FONT_SM, C_TEXT);
             lv_obj_align(nm, LV_ALIGN_TOP_MID, 0, 4);
 
             lv_obj_t* ok = lv_label_create(slot);
             lv_label_set_text(ok, "OK");
-            lv_obj_set_style_text_color(ok, C_BTN_ACTIVE, 0);
-            lv_obj_set_style_text_font(ok, FONT_SM, 0);
+            theme_text(ok, FONT_SM, C_BTN_ACTIVE);
             lv_obj_align(ok, LV_ALIGN_BOTTOM_MID, 0, -4);
         } else if (i == _setupRegistered) {
             _mkLabel(slot, "SCAN", LV_ALIGN_TOP_MID, 0, 6, FONT_MD, C_TEXT);
@@ -544,32 +781,28 @@ static void _buildSetupPlayers() {
 
     _showScreen(scr);
 
-    // NFC polling timer
+    // Player cards, read on the NFC task
     if (_setupRegistered < G.numPlayers) {
-        _activeTimer = lv_timer_create([](lv_timer_t* t) {
+        _nfcJob(NFC_JOB_READ_PLAYER, nullptr, [](const NfcResult& r) {
             if (_setupRegistered >= G.numPlayers) { return; }
-            uint8_t uid[7]; uint8_t uidLen;
-            if (nfc_pollCard(uid, &uidLen, 80)) {
-                NfcPlayerCard card;
-                if (!nfc_readPlayerCard(uid, uidLen, card)) {
-                    hw_playError();   // unreadable / not a player card
-                    return;
-                }
-                if (_isTokenTaken(card.name)) {
-                    hw_playError();   // duplicate token
-                    return;
-                }
-                Player& p = G.players[_setupRegistered];
-                memcpy(p.uid, uid, uidLen);
-                p.uidLen = uidLen;
-                strncpy(p.name, card.name, MAX_NAME_LEN);
-                p.colour = card.colour;
-                hw_playSuccess();
-                _setupRegistered++;
-                G.phase = PHASE_SETUP_PLAYERS;
-                G.screenDirty = true;
+            if (!r.ok) {
+                hw_playError();   // unreadable / not a player card
+                return;
             }
-        }, NFC_POLL_INTERVAL_MS, nullptr);
+            if (_isTokenTaken(r.player.name)) {
+                hw_playError();   // duplicate token
+                return;
+            }
+            Player& p = G.players[_setupRegistered];
+            memcpy(p.uid, r.uid, r.uidLen);
+            p.uidLen = r.uidLen;
+            strncpy(p.name, r.player.name, MAX_NAME_LEN);
+            p.colour = r.player.colour;
+            hw_playSuccess();
+            _setupRegistered++;
+            G.phase = PHASE_SETUP_PLAYERS;
+            G.screenDirty = true;
+        });
     }
 }
 
@@ -585,41 +818,43 @@ static void _evTrade(lv_event_t* e)     { G.phase = PHASE_TRADE_SELECT; G.screen
 static void _evQuickMenu(lv_event_t* e) { G.phase = PHASE_QUICK_MENU;   G.screenDirty = true; }
 static void _evSaveGame(lv_event_t* e)  { storage_saveGame(); hw_playSuccess(); }
 
-static void _buildTurnStart() {
+// Pooled: build once, refresh per turn
+#define TS_MINIS  ((SCREEN_W - 72 - 2) / 76 + 1)     // other-player strips that fit
+enum { TS_HDR, TS_NAME, TS_MONEY, TS_POS, TS_RANK, TS_DOUBLES, TS_MINI };
+static_assert(TS_MINI + TS_MINIS * MINI_WIDGETS <= UI_POOL_WIDGETS, "turn start widgets");
+
+static lv_obj_t* _createTurnStart(lv_obj_t** w) {
     lv_obj_t* scr = _newScreen();
-    const Player& p = G.players[G.currentPlayer];
 
     // Player colour header
     lv_obj_t* hdr = lv_obj_create(scr);
     lv_obj_remove_style_all(hdr);
     lv_obj_set_size(hdr, SCREEN_W, 30);
     lv_obj_set_pos(hdr, 0, 0);
-    lv_obj_set_style_bg_color(hdr, _c(p.colour), 0);
     lv_obj_set_style_bg_opa(hdr, LV_OPA_COVER, 0);
+    w[TS_HDR] = hdr;
 
-    char buf[48];
-    snprintf(buf, sizeof(buf), " %s's Turn", p.name);
     lv_obj_t* hn = lv_label_create(hdr);
-    lv_label_set_text(hn, buf);
-    lv_obj_set_style_text_color(hn, C_TEXT, 0);
-    lv_obj_set_style_text_font(hn, FONT_MD, 0);
+    lv_label_set_text(hn, "");
+    theme_text(hn, FONT_MD, C_TEXT);
     lv_obj_align(hn, LV_ALIGN_LEFT_MID, 4, 0);
+    w[TS_NAME] = hn;
 
-    snprintf(buf, sizeof(buf), "$%ld ", (long)p.money);
     lv_obj_t* hm = lv_label_create(hdr);
-    lv_label_set_text(hm, buf);
-    lv_obj_set_style_text_color(hm, C_TEXT, 0);
-    lv_obj_set_style_text_font(hm, FONT_MD, 0);
-    lv_obj_align(hm, LV_ALIGN_RIGHT_MID, -4, 0);
-
-    // Position info
-    snprintf(buf, sizeof(buf), "Pos: %s (#%d)", TILES[p.position].name, p.position);
-    _mkLabel(scr, buf, LV_ALIGN_TOP_LEFT, 10, 34, FONT_SM, C_TEXT_DIM);
-
-    if (G.isDoubles && p.doublesCount > 0) {
-        snprintf(buf, sizeof(buf), "Doubles! (%d)", p.doublesCount);
-        _mkLabel(scr, buf, LV_ALIGN_TOP_LEFT, 10, 48, FONT_SM, C_WARN);
-    }
+    lv_label_set_text(hm, "");
+    theme_text(hm, FONT_MD, C_TEXT);
+    lv_obj_align(hm, LV_ALIGN_RIGHT_MID, -8, 0);
+    _bind(hm, GC_MONEY, 0, _drawMoney);
+    w[TS_MONEY] = hm;
+
+    // Position, standing, doubles
+    w[TS_POS]     = _mkLabel(scr, "", LV_ALIGN_TOP_LEFT, 10, 34, FONT_SM, C_TEXT_DIM);
+    w[TS_RANK]    = _mkLabel(scr, "", LV_ALIGN_TOP_RIGHT, -10, 34, FONT_SM, C_ACCENT);
+    w[TS_DOUBLES] = _mkLabel(scr, "", LV_ALIGN_TOP_LEFT, 10, 48, FONT_SM, C_WARN);
+    _bind(w[TS_POS], GC_POSITION, 0, _drawPosition);
+    _bind(w[TS_RANK], GC_MONEY, BIND_ANY, _drawStanding);
+    _bind(w[TS_RANK], GC_OWNER, BIND_ANY, _drawStanding);
+    _bind(w[TS_RANK], GC_HOUSES, BIND_ANY, _drawStanding);
 
     // Big roll button
     _mkBtn(scr, "TAP TO ROLL", 60, 68, 200, 65, C_BTN_BG, _evRollDice);
@@ -630,16 +865,47 @@ static void _buildTurnStart() {
     _mkBtn(scr, "Save", 135, 148, 60, 28, C_BTN_BG, _evSaveGame);
     _mkBtn(scr, "Menu", 200, 148, 60, 28, C_DANGER, _evQuickMenu);
 
-    // Other players
-    int16_t px = 2, py = 186;
-    for (uint8_t i = 0; i < G.numPlayers; i++) {
+    for (uint8_t k = 0; k < TS_MINIS; k++) _mkMini(scr, 2 + 76 * k, 186, &w[TS_MINI + k * MINI_WIDGETS]);
+    return scr;
+}
+
+static void _refreshTurnStart(lv_obj_t** w) {
+    const Player& p = G.players[G.currentPlayer];
+    char buf[48];
+
+    _setBg(w[TS_HDR], _c(p.colour));
+    snprintf(buf, sizeof(buf), " %s's Turn", p.name);
+    _setText(w[TS_NAME], buf);
+    _rebind(w[TS_MONEY], G.currentPlayer, _drawMoney);
+    _rebind(w[TS_POS], G.currentPlayer, _drawPosition);
+
+    // Standing (maintained by the engine, no recompute here)
+    _drawStanding(w[TS_RANK], BIND_ANY);
+
+    bool doubles = G.isDoubles && p.doublesCount > 0;
+    if (doubles) {
+        snprintf(buf, sizeof(buf), "Doubles! (%d)", p.doublesCount);
+        _setText(w[TS_DOUBLES], buf);
+    }
+    _setShown(w[TS_DOUBLES], doubles);
+
+    // Other players, leader first
+    uint8_t k = 0;
+    for (uint8_t r = 0; r < G.numPlayers && k < TS_MINIS; r++) {
+        uint8_t i = G.rankOrder[r];
         if (i == G.currentPlayer || !G.players[i].alive) continue;
-        _mkPlayerMini(scr, px, py, i);
-        px += 76;
-        if (px > SCREEN_W - 72) break;
+        lv_obj_t** mini = &w[TS_MINI + k * MINI_WIDGETS];
+        _setMini(mini, i);
+        _setShown(mini[MINI_CONT], true);
+        k++;
     }
+    for (; k < TS_MINIS; k++) _setShown(w[TS_MINI + k * MINI_WIDGETS + MINI_CONT], false);
+}
 
-    _showScreen(scr);
+static void _buildTurnStart() {
+    _Pooled* e = _poolGet(_POOL_KEY(PHASE_TURN_START, 0), _createTurnStart);
+    _refreshTurnStart(e->w);
+    _showScreen(e->scr);
 }
 
 // =============================================================================
@@ -647,9 +913,15 @@ static void _buildTurnStart() {
 // =============================================================================
 static lv_obj_t* _diceL1 = nullptr;
 static lv_obj_t* _diceL2 = nullptr;
+static lv_obj_t* _diceTotal = nullptr;
+static lv_obj_t* _diceDoubles = nullptr;
 static int _diceAnimCount = 0;
+static uint32_t _diceFrames = 0;        // hw_displayStats().frames at roll start
+static uint32_t _diceStartMs = 0;
 
-static void _buildRolling() {
+enum { RL_BOX1, RL_BOX2, RL_DIE1, RL_DIE2, RL_TOTAL, RL_DOUBLES };
+
+static lv_obj_t* _createRolling(lv_obj_t** w) {
     lv_obj_t* scr = _newScreen();
     _mkHeader(scr, "Rolling...", C_PRIMARY);
 
@@ -663,28 +935,44 @@ static void _buildRolling() {
         lv_obj_set_style_bg_opa(box, LV_OPA_COVER, 0);
         lv_obj_set_style_radius(box, 8, 0);
         lv_obj_set_style_border_width(box, 2, 0);
-        lv_obj_set_style_border_color(box, _c(G.players[G.currentPlayer].colour), 0);
 
         lv_obj_t* lbl = lv_label_create(box);
         lv_label_set_text(lbl, "?");
-        lv_obj_set_style_text_color(lbl, lv_color_black(), 0);
-        lv_obj_set_style_text_font(lbl, FONT_XL, 0);
+        theme_text(lbl, FONT_XL, lv_color_black());
         lv_obj_center(lbl);
 
-        if (i == 0) _diceL1 = lbl; else _diceL2 = lbl;
+        w[RL_BOX1 + i] = box;
+        w[RL_DIE1 + i] = lbl;
     }
 
-    lv_obj_t* totalLbl = _mkLabel(scr, "", LV_ALIGN_CENTER, 0, 50, FONT_MD, C_ACCENT);
-    lv_obj_t* doublesLbl = _mkLabel(scr, "", LV_ALIGN_CENTER, 0, 72, FONT_MD, C_WARN);
+    w[RL_TOTAL]   = _mkLabel(scr, "", LV_ALIGN_CENTER, 0, 50, FONT_MD, C_ACCENT);
+    w[RL_DOUBLES] = _mkLabel(scr, "", LV_ALIGN_CENTER, 0, 72, FONT_MD, C_WARN);
+    return scr;
+}
+
+static void _refreshRolling(lv_obj_t** w) {
+    lv_color_t col = _c(G.players[G.currentPlayer].colour);
+    _setBorder(w[RL_BOX1], col);
+    _setBorder(w[RL_BOX2], col);
+    _setText(w[RL_DIE1], "?");
+    _setText(w[RL_DIE2], "?");
+    _setText(w[RL_TOTAL], "");
+    _setText(w[RL_DOUBLES], "");
+}
 
-    _showScreen(scr);
+static void _buildRolling() {
+    _Pooled* e = _poolGet(_POOL_KEY(PHASE_ROLLING, 0), _createRolling);
+    _refreshRolling(e->w);
+    _showScreen(e->scr);
 
     // Animation timer
     _diceAnimCount = 0;
-    static lv_obj_t* _totalRef = totalLbl;
-    static lv_obj_t* _doublesRef = doublesLbl;
-    _totalRef = totalLbl;
-    _doublesRef = doublesLbl;
+    _diceFrames  = hw_displayStats().frames;
+    _diceStartMs = millis();
+    _diceL1      = e->w[RL_DIE1];
+    _diceL2      = e->w[RL_DIE2];
+    _diceTotal   = e->w[RL_TOTAL];
+    _diceDoubles = e->w[RL_DOUBLES];
 
     _activeTimer = lv_timer_create([](lv_timer_t* t) {
         _diceAnimCount++;
@@ -705,9 +993,15 @@ static void _buildRolling() {
 
             char buf[20];
             snprintf(buf, sizeof(buf), "Total: %d", G.dice1 + G.dice2);
-            lv_label_set_text(_totalRef, buf);
-            if (G.isDoubles) lv_label_set_text(_doublesRef, "DOUBLES!");
+            lv_label_set_text(_diceTotal, buf);
+            if (G.isDoubles) lv_label_set_text(_diceDoubles, "DOUBLES!");
         } else if (_diceAnimCount >= animTicks + 8) {
+#if DEBUG
+            uint32_t ms = millis() - _diceStartMs;
+            uint32_t frames = hw_displayStats().frames - _diceFrames;
+            DBG("UI: dice %lu frames in %lu ms = %lu.%lu fps", (unsigned long)frames, (unsigned long)ms,
+                (unsigned long)(frames * 1000 / ms), (unsigned long)(frames * 10000 / ms % 10));
+#endif
             // Advance game
             game_movePlayer();
             if (G.phase == PHASE_MOVED) game_resolveTile();
@@ -730,7 +1024,19 @@ static void _evBuyProperty(lv_event_t* e) {
     G.screenDirty = true;
 }
 static void _evSkipBuy(lv_event_t* e)    { game_endTurn(); G.screenDirty = true; }
-static void _evPayRent(lv_event_t* e)    { game_payRent(G.currentPlayer, G.players[G.currentPlayer].position); hw_playCashOut(); game_endTurn(); G.screenDirty = true; }
+// Both balances change in place on the shown screen, then the turn moves on
+static void _evPayRent(lv_event_t* e) {
+    lv_obj_t* btn = (lv_obj_t*)lv_event_get_target(e);
+    if (lv_obj_has_flag(btn, LV_OBJ_FLAG_HIDDEN)) return;
+    _setShown(btn, false);
+    game_payRent(G.currentPlayer, G.players[G.currentPlayer].position);
+    hw_playCashOut();
+    _activeTimer = lv_timer_create([](lv_timer_t* t) {
+        _activeTimer = nullptr;
+        lv_timer_delete(t);
+        game_endTurn();
+    }, RENT_SHOW_MS, nullptr);
+}
 static void _evContinue(lv_event_t* e)   { game_endTurn(); G.screenDirty = true; }
 static void _evPayTax(lv_event_t* e) {
     const Player& p = G.players[G.currentPlayer];
@@ -739,8 +1045,7 @@ static void _evPayTax(lv_event_t* e) {
 }
 static void _evFreeParking(lv_event_t* e) {
     if (G.settings.freeParkingPool && G.freeParkingPool > 0) {
-        G.players[G.currentPlayer].money += G.freeParkingPool;
-        G.freeParkingPool = 0; hw_playCashIn();
+        game_collectFreeParking(G.currentPlayer); hw_playCashIn();
     }
     game_endTurn(); G.screenDirty = true;
 }
@@ -749,110 +1054,162 @@ static void _evBuildHouse(lv_event_t* e) {
     const Player& p = G.players[G.currentPlayer];
     if (game_buildHouse(G.currentPlayer, p.position)) hw_playSuccess();
     else hw_playError();
-    G.screenDirty = true;
 }
 
-static void _buildTileAction() {
+// Pooled per tile action: the layout follows G.tileAction, the values the tile
+enum { TA_STRIP, TA_NAME, TA_L1, TA_L2, TA_BTN, TA_MONEY, TA_OWNER };
+
+static lv_obj_t* _createTileAction(lv_obj_t** w) {
     lv_obj_t* scr = _newScreen();
-    const Player& p = G.players[G.currentPlayer];
-    const TileData& tile = TILES[p.position];
-    lv_color_t gc = (tile.group != GROUP_NONE) ? _groupColor(tile.group) : C_PRIMARY;
 
     // Tile colour strip at top
     lv_obj_t* strip = lv_obj_create(scr);
     lv_obj_remove_style_all(strip);
     lv_obj_set_size(strip, SCREEN_W, 8);
     lv_obj_set_pos(strip, 0, 0);
-    lv_obj_set_style_bg_color(strip, gc, 0);
     lv_obj_set_style_bg_opa(strip, LV_OPA_COVER, 0);
+    w[TA_STRIP] = strip;
 
     // Tile name
-    _mkLabel(scr, tile.name, LV_ALIGN_TOP_MID, 0, 14, FONT_MD, C_TEXT);
+    w[TA_NAME] = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 14, FONT_MD, C_TEXT);
+
+    switch (G.tileAction) {
+        case ACT_BUY:
+            _mkLabel(scr, "Unowned Property", LV_ALIGN_TOP_MID, 0, 38, FONT_SM, C_TEXT_DIM);
+            w[TA_L1]  = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 58, FONT_MD, C_ACCENT);
+            w[TA_L2]  = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 80, FONT_SM, C_TEXT_DIM);
+            w[TA_BTN] = _mkBtn(scr, "BUY", 30, 105, 120, 45, C_BTN_ACTIVE, _evBuyProperty);
+            _mkBtn(scr, "SKIP", 170, 105, 120, 45, C_BTN_BG, _evSkipBuy);
+            break;
+
+        case ACT_PAY_RENT:
+            _mkLabel(scr, "Rent Due!", LV_ALIGN_TOP_MID, 0, 42, FONT_MD, C_DANGER);
+            w[TA_L1] = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 66, FONT_SM, C_TEXT);
+            w[TA_L2] = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 88, FONT_XL, C_ACCENT);
+            w[TA_BTN] = _mkBtn(scr, "PAY RENT", 80, 125, 160, 45, C_DANGER, _evPayRent);
+            w[TA_OWNER] = _mkLabel(scr, "", LV_ALIGN_BOTTOM_LEFT, 5, -5, FONT_MD, C_TEXT);
+            _bind(w[TA_OWNER], GC_MONEY, 0, _drawNameMoney);
+            break;
+
+        case ACT_OWN_PROP:
+            _mkLabel(scr, "Your Property!", LV_ALIGN_TOP_MID, 0, 42, FONT_MD, C_BTN_ACTIVE);
+            w[TA_L1]  = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 66, FONT_SM, C_TEXT);
+            w[TA_L2]  = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 86, FONT_SM, C_ACCENT);
+            w[TA_BTN] = _mkBtn(scr, "UPGRADE", 20, 108, 130, 40, C_BTN_ACTIVE, _evBuildHouse);
+            _mkBtn(scr, "CONTINUE", 170, 108, 130, 40, C_BTN_BG, _evContinue);
+            // An upgrade redraws these and the balance, not the screen
+            _bind(w[TA_L1], GC_HOUSES, 0, _drawHouses);
+            _bind(w[TA_L2], GC_HOUSES, 0, _drawUpgradeCost);
+            _bind(w[TA_BTN], GC_HOUSES, 0, _drawUpgradeBtn);
+            break;
+
+        case ACT_TAX:
+            w[TA_L1] = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 50, FONT_MD, C_DANGER);
+            w[TA_L2] = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 80, FONT_XL, C_ACCENT);
+            _mkBtn(scr, "PAY TAX", 80, 120, 160, 45, C_DANGER, _evPayTax);
+            break;
+
+        case ACT_FREE_PARKING:
+            _mkLabel(scr, "Free Parking!", LV_ALIGN_TOP_MID, 0, 55, FONT_MD, C_BTN_ACTIVE);
+            w[TA_L1] = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 85, FONT_SM, C_TEXT_DIM);
+            _mkBtn(scr, "CONTINUE", 80, 115, 160, 45, C_BTN_ACTIVE, _evFreeParking);
+            break;
+
+        case ACT_GO_TO_JAIL:
+            _mkLabel(scr, "GO TO JAIL!", LV_ALIGN_TOP_MID, 0, 60, FONT_XL, C_DANGER);
+            _mkLabel(scr, "Do not pass GO", LV_ALIGN_TOP_MID, 0, 100, FONT_SM, C_TEXT_DIM);
+            _mkLabel(scr, "Do not collect $200", LV_ALIGN_TOP_MID, 0, 116, FONT_SM, C_TEXT_DIM);
+            _mkBtn(scr, "OK", 80, 145, 160, 40, C_DANGER, _evGoToJailOk);
+            break;
+
+        case ACT_JUST_VISITING:
+            _mkLabel(scr, "Just Visiting!", LV_ALIGN_TOP_MID, 0, 75, FONT_MD, C_TEXT);
+            _mkBtn(scr, "CONTINUE", 80, 115, 160, 40, C_BTN_BG, _evContinue);
+            break;
+
+        default:
+            w[TA_L1] = _mkLabel(scr, "", LV_ALIGN_TOP_MID, 0, 75, FONT_MD, C_TEXT);
+            _mkBtn(scr, "CONTINUE", 80, 115, 160, 40, C_BTN_BG, _evContinue);
+            break;
+    }
+
+    // Money at bottom
+    w[TA_MONEY] = _mkLabel(scr, "", LV_ALIGN_BOTTOM_RIGHT, -5, -5, FONT_MD, C_ACCENT);
+    _bind(w[TA_MONEY], GC_MONEY, 0, _drawMoney);
+    return scr;
+}
 
+static void _refreshTileAction(lv_obj_t** w) {
+    const Player& p = G.players[G.currentPlayer];
+    const TileData& tile = TILES[p.position];
     char buf[48];
 
+    _setBg(w[TA_STRIP], (tile.group != GROUP_NONE) ? _groupColor(tile.group) : C_PRIMARY);
+    _setText(w[TA_NAME], tile.name);
+
     switch (G.tileAction) {
         case ACT_BUY: {
-            _mkLabel(scr, "Unowned Property", LV_ALIGN_TOP_MID, 0, 38, FONT_SM, C_TEXT_DIM);
             snprintf(buf, sizeof(buf), "Price: $%d", tile.price);
-            _mkLabel(scr, buf, LV_ALIGN_TOP_MID, 0, 58, FONT_MD, C_ACCENT);
+            _setText(w[TA_L1], buf);
             snprintf(buf, sizeof(buf), "Base rent: $%d", tile.rent[0]);
-            _mkLabel(scr, buf, LV_ALIGN_TOP_MID, 0, 80, FONT_SM, C_TEXT_DIM);
-
+            _setText(w[TA_L2], buf);
             bool canBuy = (p.money >= tile.price);
-            _mkBtn(scr, "BUY", 30, 105, 120, 45,
-                   canBuy ? C_BTN_ACTIVE : lv_color_hex(0x3C3C3C), _evBuyProperty);
-            _mkBtn(scr, "SKIP", 170, 105, 120, 45, C_BTN_BG, _evSkipBuy);
+            _setBtnColor(w[TA_BTN], canBuy ? C_BTN_ACTIVE : lv_color_hex(0x3C3C3C));
             break;
         }
         case ACT_PAY_RENT: {
             int8_t owner = G.props[p.position].owner;
             int32_t rent = game_calcRent(p.position, G.dice1 + G.dice2);
-            _mkLabel(scr, "Rent Due!", LV_ALIGN_TOP_MID, 0, 42, FONT_MD, C_DANGER);
             snprintf(buf, sizeof(buf), "Owner: %s", G.players[owner].name);
-            _mkLabel(scr, buf, LV_ALIGN_TOP_MID, 0, 66, FONT_SM, C_TEXT);
+            _setText(w[TA_L1], buf);
             snprintf(buf, sizeof(buf), "$%ld", (long)rent);
-            _mkLabel(scr, buf, LV_ALIGN_TOP_MID, 0, 88, FONT_XL, C_ACCENT);
-            _mkBtn(scr, "PAY RENT", 80, 125, 160, 45, C_DANGER, _evPayRent);
+            _setText(w[TA_L2], buf);
+            _setShown(w[TA_BTN], true);
+            _rebind(w[TA_OWNER], owner, _drawNameMoney);
             break;
         }
-        case ACT_OWN_PROP: {
-            _mkLabel(scr, "Your Property!", LV_ALIGN_TOP_MID, 0, 42, FONT_MD, C_BTN_ACTIVE);
-            uint8_t h = G.props[p.position].houses;
-            snprintf(buf, sizeof(buf), h == 5 ? "HOTEL" : "Houses: %d", h);
-            _mkLabel(scr, buf, LV_ALIGN_TOP_MID, 0, 66, FONT_SM, C_TEXT);
-
-            if (tile.type == TILE_PROPERTY && h < MAX_HOUSES
-                && game_ownsFullGroup(G.currentPlayer, tile.group)) {
-                snprintf(buf, sizeof(buf), "Upgrade: $%d", tile.houseCost);
-                _mkLabel(scr, buf, LV_ALIGN_TOP_MID, 0, 86, FONT_SM, C_ACCENT);
-                _mkBtn(scr, "UPGRADE", 20, 108, 130, 40, C_BTN_ACTIVE, _evBuildHouse);
-            }
-            _mkBtn(scr, "CONTINUE", 170, 108, 130, 40, C_BTN_BG, _evContinue);
+        case ACT_OWN_PROP:
+            _rebind(w[TA_L1], p.position, _drawHouses);
+            _rebind(w[TA_L2], p.position, _drawUpgradeCost);
+            _rebind(w[TA_BTN], p.position, _drawUpgradeBtn);
             break;
-        }
+
         case ACT_TAX:
-            _mkLabel(scr, tile.name, LV_ALIGN_TOP_MID, 0, 50, FONT_MD, C_DANGER);
+            _setText(w[TA_L1], tile.name);
             snprintf(buf, sizeof(buf), "$%d", tile.price);
-            _mkLabel(scr, buf, LV_ALIGN_TOP_MID, 0, 80, FONT_XL, C_ACCENT);
-            _mkBtn(scr, "PAY TAX", 80, 120, 160, 45, C_DANGER, _evPayTax);
+            _setText(w[TA_L2], buf);
             break;
 
-        case ACT_FREE_PARKING: {
-            _mkLabel(scr, "Free Parking!", LV_ALIGN_TOP_MID, 0, 55, FONT_MD, C_BTN_ACTIVE);
+        case ACT_FREE_PARKING:
             if (G.settings.freeParkingPool && G.freeParkingPool > 0) {
                 snprintf(buf, sizeof(buf), "Collect $%ld!", (long)G.freeParkingPool);
-                _mkLabel(scr, buf, LV_ALIGN_TOP_MID, 0, 85, FONT_MD, C_ACCENT);
+                _setText(w[TA_L1], buf);
+                _setLabelStyle(w[TA_L1], FONT_MD, C_ACCENT);
             } else {
-                _mkLabel(scr, "Nothing happens", LV_ALIGN_TOP_MID, 0, 85, FONT_SM, C_TEXT_DIM);
+                _setText(w[TA_L1], "Nothing happens");
+                _setLabelStyle(w[TA_L1], FONT_SM, C_TEXT_DIM);
             }
-            _mkBtn(scr, "CONTINUE", 80, 115, 160, 45, C_BTN_ACTIVE, _evFreeParking);
             break;
-        }
+
         case ACT_GO_TO_JAIL:
-            _mkLabel(scr, "GO TO JAIL!", LV_ALIGN_TOP_MID, 0, 60, FONT_XL, C_DANGER);
-            _mkLabel(scr, "Do not pass GO", LV_ALIGN_TOP_MID, 0, 100, FONT_SM, C_TEXT_DIM);
-            _mkLabel(scr, "Do not collect $200", LV_ALIGN_TOP_MID, 0, 116, FONT_SM, C_TEXT_DIM);
-            _mkBtn(scr, "OK", 80, 145, 160, 40, C_DANGER, _evGoToJailOk);
             hw_playJail();
             break;
 
         case ACT_JUST_VISITING:
-            _mkLabel(scr, "Just Visiting!", LV_ALIGN_TOP_MID, 0, 75, FONT_MD, C_TEXT);
-            _mkBtn(scr, "CONTINUE", 80, 115, 160, 40, C_BTN_BG, _evContinue);
             break;
 
         default:
-            _mkLabel(scr, tile.name, LV_ALIGN_TOP_MID, 0, 75, FONT_MD, C_TEXT);
-            _mkBtn(scr, "CONTINUE", 80, 115, 160, 40, C_BTN_BG, _evContinue);
+            _setText(w[TA_L1], tile.name);
             break;
     }
 
-    // Money at bottom
-    snprintf(buf, sizeof(buf), "$%ld", (long)p.money);
-    _mkLabel(scr, buf, LV_ALIGN_BOTTOM_RIGHT, -5, -5, FONT_MD, C_ACCENT);
+    _rebind(w[TA_MONEY], G.currentPlayer, _drawMoney);
+}
 
-    _showScreen(scr);
+static void _buildTileAction() {
+    _Pooled* e = _poolGet(_POOL_KEY(PHASE_TILE_ACTION, G.tileAction), _createTileAction);
+    _refreshTileAction(e->w);
+    _showScreen(e->scr);
 }
 
 // =============================================================================
@@ -910,15 +1267,13 @@ static void _buildCardDraw() {
     lv_obj_set_style_bg_opa(tbar, LV_OPA_COVER, 0);
     lv_obj_t* tl = lv_label_create(tbar);
     lv_label_set_text(tl, title);
-    lv_obj_set_style_text_color(tl, C_TEXT, 0);
-    lv_obj_set_style_text_font(tl, FONT_MD, 0);
+    theme_text(tl, FONT_MD, C_TEXT);
     lv_obj_center(tl);
 
     // Card text
     lv_obj_t* ct = lv_label_create(frame);
     lv_label_set_text(ct, card.text);
-    lv_obj_set_style_text_color(ct, lv_color_black(), 0);
-    lv_obj_set_style_text_font(ct, FONT_MD, 0);
+    theme_text(ct, FONT_MD, lv_color_black());
     lv_obj_set_width(ct, 260);
     lv_label_set_long_mode(ct, LV_LABEL_LONG_WRAP);
     lv_obj_align(ct, LV_ALIGN_TOP_MID, 0, 38);
@@ -1085,6 +1440,14 @@ static void _evQmBack(lv_event_t* e)    { G.phase = PHASE_TURN_START; G.screenDi
 static void _evQmEndTurn(lv_event_t* e) { G.isDoubles = false; game_endTurn(); G.screenDirty = true; }
 static void _evQmQuit(lv_event_t* e)    { G.phase = PHASE_MENU; G.screenDirty = true; }
 
+static void _drawPlayerRow(lv_obj_t* lbl, uint8_t idx) {
+    const Player& p = G.players[idx];
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%-10s $%-6ld P:%d %s",
+             p.name, (long)p.money, p.position, p.alive ? "" : "(OUT)");
+    _setText(lbl, buf);
+}
+
 static void _buildQuickMenu() {
     lv_obj_t* scr = _newScreen();
     _mkHeader(scr, "Quick Menu", C_PRIMARY);
@@ -1097,9 +1460,8 @@ static void _buildQuickMenu() {
         lv_obj_remove_style_all(row);
         lv_obj_set_size(row, 310, 22);
         lv_obj_set_pos(row, 5, y);
-        lv_obj_set_style_bg_color(row, (i == G.currentPlayer) ? lv_color_hex(0x1E321E) : C_BG_DARK, 0);
-        lv_obj_set_style_bg_opa(row, LV_OPA_COVER, 0);
-        lv_obj_set_style_radius(row, 3, 0);
+        theme_strip(row);
+        if (i == G.currentPlayer) lv_obj_set_style_bg_color(row, lv_color_hex(0x1E321E), 0);
         lv_obj_set_scrollbar_mode(row, LV_SCROLLBAR_MODE_OFF);
 
         // Color dot
@@ -1108,18 +1470,13 @@ static void _buildQuickMenu() {
         lv_obj_set_size(dot, 10, 10);
         lv_obj_set_pos(dot, 2, 6);
         lv_obj_set_style_bg_color(dot, _c(p.colour), 0);
-        lv_obj_set_style_bg_opa(dot, LV_OPA_COVER, 0);
-        lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, 0);
+        theme_dot(dot);
 
-        char buf[48];
-        snprintf(buf, sizeof(buf), "%-10s $%-6ld P:%d %s",
-                 p.name, (long)p.money, p.position,
-                 p.alive ? "" : "(OUT)");
         lv_obj_t* lbl = lv_label_create(row);
-        lv_label_set_text(lbl, buf);
-        lv_obj_set_style_text_color(lbl, p.alive ? C_TEXT : C_TEXT_DIM, 0);
-        lv_obj_set_style_text_font(lbl, FONT_SM, 0);
+        theme_text(lbl, FONT_SM, p.alive ? C_TEXT : C_TEXT_DIM);
         lv_obj_set_pos(lbl, 16, 4);
+        _bind(lbl, GC_MONEY, i, _drawPlayerRow);
+        _bind(lbl, GC_POSITION, i, _drawPlayerRow);
 
         y += 24;
     }
@@ -1145,8 +1502,7 @@ static void _buildQuickMenu() {
                  h == 5 ? " [H]" : h > 0 ? "" : "");
         lv_obj_t* pl = lv_label_create(scr);
         lv_label_set_text(pl, buf);
-        lv_obj_set_style_text_color(pl, C_TEXT, 0);
-        lv_obj_set_style_text_font(pl, FONT_SM, 0);
+        theme_text(pl, FONT_SM, C_TEXT);
         lv_obj_set_pos(pl, 20, y);
         y += 14;
     }
@@ -1243,28 +1599,24 @@ static void _buildProgramming() {
             lv_obj_set_size(dot, 20, 20);
             lv_obj_align(dot, LV_ALIGN_TOP_MID, 0, 110);
             lv_obj_set_style_bg_color(dot, _c(_pCard.colour), 0);
-            lv_obj_set_style_bg_opa(dot, LV_OPA_COVER, 0);
-            lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, 0);
+            theme_dot(dot);
 
             _mkBtn(scr, "CANCEL", 10, 210, 70, 25, C_DANGER, _evProgBack);
 
-            // NFC poll timer
+            // Written by the NFC task on the next card presented
             _showScreen(scr);
-            _activeTimer = lv_timer_create([](lv_timer_t* t) {
-                uint8_t uid[7]; uint8_t uidLen;
-                if (nfc_pollCard(uid, &uidLen, 100)) {
-                    _pCard.type = NFC_TYPE_PLAYER;
-                    if (nfc_writePlayerCard(uid, uidLen, _pCard)) {
-                        hw_playSuccess();
-                        _usedTokens |= (1 << _progTokenIdx); // mark as used
-                    } else {
-                        hw_playError();
-                    }
-                    _progMode = 0;
-                    G.phase = PHASE_PROGRAMMING;
-                    G.screenDirty = true;
+            _pCard.type = NFC_TYPE_PLAYER;
+            _nfcJob(NFC_JOB_WRITE_PLAYER, &_pCard, [](const NfcResult& r) {
+                if (r.ok) {
+                    hw_playSuccess();
+                    _usedTokens |= (1 << _progTokenIdx); // mark as used
+                } else {
+                    hw_playError();
                 }
-            }, NFC_POLL_INTERVAL_MS, nullptr);
+                _progMode = 0;
+                G.phase = PHASE_PROGRAMMING;
+                G.screenDirty = true;
+            });
             return;
         }
     }
@@ -1290,21 +1642,18 @@ static void _buildProgramming() {
             _mkBtn(scr, "CANCEL", 10, 210, 70, 25, C_DANGER, _evProgBack);
 
             _showScreen(scr);
-            _activeTimer = lv_timer_create([](lv_timer_t* t) {
-                uint8_t uid[7]; uint8_t uidLen;
-                if (nfc_pollCard(uid, &uidLen, 100)) {
-                    NfcPropertyCard card;
-                    card.type = NFC_TYPE_PROPERTY;
-                    card.tileIndex = _propIdx;
-                    card.group = TILES[_propIdx].group;
-                    strncpy(card.name, TILES[_propIdx].name, MAX_NAME_LEN);
-                    if (nfc_writePropertyCard(uid, uidLen, card)) hw_playSuccess();
-                    else hw_playError();
-                    _progMode = 0; _progStep = 0;
-                    G.phase = PHASE_PROGRAMMING;
-                    G.screenDirty = true;
-                }
-            }, NFC_POLL_INTERVAL_MS, nullptr);
+            NfcPropertyCard card = {};
+            card.type = NFC_TYPE_PROPERTY;
+            card.tileIndex = _propIdx;
+            card.group = TILES[_propIdx].group;
+            strncpy(card.name, TILES[_propIdx].name, MAX_NAME_LEN);
+            _nfcJob(NFC_JOB_WRITE_PROPERTY, &card, [](const NfcResult& r) {
+                if (r.ok) hw_playSuccess();
+                else hw_playError();
+                _progMode = 0; _progStep = 0;
+                G.phase = PHASE_PROGRAMMING;
+                G.screenDirty = true;
+            });
             return;
         }
     }
@@ -1315,19 +1664,16 @@ static void _buildProgramming() {
         _mkBtn(scr, "CANCEL", 10, 210, 70, 25, C_DANGER, _evProgBack);
 
         _showScreen(scr);
-        _activeTimer = lv_timer_create([](lv_timer_t* t) {
-            uint8_t uid[7]; uint8_t uidLen;
-            if (nfc_pollCard(uid, &uidLen, 100)) {
-                NfcEventCard card;
-                card.type = NFC_TYPE_EVENT;
-                card.eventId = 0;
-                if (nfc_writeEventCard(uid, uidLen, card)) hw_playSuccess();
-                else hw_playError();
-                _progMode = 0;
-                G.phase = PHASE_PROGRAMMING;
-                G.screenDirty = true;
-            }
-        }, NFC_POLL_INTERVAL_MS, nullptr);
+        NfcEventCard card = {};
+        card.type = NFC_TYPE_EVENT;
+        card.eventId = 0;
+        _nfcJob(NFC_JOB_WRITE_EVENT, &card, [](const NfcResult& r) {
+            if (r.ok) hw_playSuccess();
+            else hw_playError();
+            _progMode = 0;
+            G.phase = PHASE_PROGRAMMING;
+            G.screenDirty = true;
+        });
         return;
     }
 
@@ -1358,14 +1704,12 @@ static void _buildSettings() {
 
         lv_obj_t* ll = lv_label_create(row);
         lv_label_set_text(ll, label);
-        lv_obj_set_style_text_color(ll, C_TEXT, 0);
-        lv_obj_set_style_text_font(ll, FONT_SM, 0);
+        theme_text(ll, FONT_SM, C_TEXT);
         lv_obj_set_pos(ll, 10, 3);
 
         lv_obj_t* vl = lv_label_create(row);
         lv_label_set_text(vl, val);
-        lv_obj_set_style_text_color(vl, C_ACCENT, 0);
-        lv_obj_set_style_text_font(vl, FONT_SM, 0);
+        theme_text(vl, FONT_SM, C_ACCENT);
         lv_obj_align(vl, LV_ALIGN_RIGHT_MID, -10, 0);
 
         // Make row clickable
@@ -1391,7 +1735,7 @@ static void _buildSettings() {
 
     snprintf(buf, sizeof(buf), "%d turns", s.jailMaxTurns);
     lv_obj_t* r2 = addRow("Jail Max Turns", buf);
-    lv_obj_add_event_cb(r2, [](lv_event_t* e) { G.settings.jailMaxTurns = (G.settings.jailMaxTurns % 5) + 1; G.screenDirty = true; }, LV_EVENT_CLICKED, nullptr);
+    lv_obj_add_event_cb(r2, [](lv_event_t* e) { G.settings.jailMaxTurns = (G.settings.jailMaxTurns % MAX_JAIL_TURNS) + 1; G.screenDirty = true; }, LV_EVENT_CLICKED, nullptr);
 
     lv_obj_t* r3 = addRow("Auto Rent", s.autoRent ? "ON" : "OFF");
     lv_obj_add_event_cb(r3, [](lv_event_t* e) { G.settings.autoRent = !G.settings.autoRent; G.screenDirty = true; }, LV_EVENT_CLICKED, nullptr);
@@ -1421,6 +1765,7 @@ static void _evGameOverMenu(lv_event_t* e) {
     G.phase = PHASE_MENU;
     G.screenDirty = true;
 }
+static void _evGameOverStats(lv_event_t* e) { G.phase = PHASE_GAME_STATS; G.screenDirty = true; }
 
 static void _buildGameOver() {
     lv_obj_t* scr = _newScreen();
@@ -1435,8 +1780,7 @@ static void _buildGameOver() {
     lv_obj_set_size(circ, 40, 40);
     lv_obj_align(circ, LV_ALIGN_CENTER, 0, -20);
     lv_obj_set_style_bg_color(circ, _c(p.colour), 0);
-    lv_obj_set_style_bg_opa(circ, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(circ, LV_RADIUS_CIRCLE, 0);
+    theme_dot(circ);
 
     char buf[32];
     snprintf(buf, sizeof(buf), "%s WINS!", p.name);
@@ -1444,81 +1788,190 @@ static void _buildGameOver() {
     snprintf(buf, sizeof(buf), "Final: $%ld", (long)p.money);
     _mkLabel(scr, buf, LV_ALIGN_CENTER, 0, 42, FONT_SM, C_TEXT_DIM);
 
-    _mkBtn(scr, "MAIN MENU", 80, 190, 160, 40, C_BTN_ACTIVE, _evGameOverMenu);
+    _mkBtn(scr, "STATS", 20, 190, 130, 40, C_BTN_BG, _evGameOverStats);
+    _mkBtn(scr, "MAIN MENU", 170, 190, 130, 40, C_BTN_ACTIVE, _evGameOverMenu);
 
     _showScreen(scr);
 }
 
 // =============================================================================
-// ON-SCREEN KEYBOARD (blocking)
+// SCREEN: GAME STATS
 // =============================================================================
-static volatile bool _kbDone = false;
+static void _evStatsExport(lv_event_t* e) {
+    size_t n = stats_export(Serial);
+    Serial.println();
+    DBG("stats export: %u bytes", (unsigned)n);
+    hw_playSuccess();
+}
+static void _evStatsBack(lv_event_t* e) { G.phase = PHASE_GAME_OVER; G.screenDirty = true; }
 
-bool ui_keyboard(char* buf, uint8_t maxLen, const char* prompt) {
+static void _buildGameStats() {
     lv_obj_t* scr = _newScreen();
-    lv_obj_set_style_bg_color(scr, C_BG, 0);
-    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    _mkHeader(scr, "GAME STATS", C_PRIMARY);
+    char buf[48];
+
+    // Cash history, one line per player
+    int32_t lo = 0, hi = 1;
+    for (uint8_t p = 0; p < G.numPlayers; p++) {
+        for (uint8_t i = 0; i < S.cashCount; i++) {
+            int32_t v = stats_cash(p, i);
+            if (v < lo) lo = v;
+            if (v > hi) hi = v;
+        }
+    }
+    lv_obj_t* chart = lv_chart_create(scr);
+    lv_obj_set_size(chart, 200, 110);
+    lv_obj_set_pos(chart, 5, 32);
+    lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_point_count(chart, S.cashCount > 1 ? S.cashCount : 2);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, lo, hi);
+    lv_chart_set_div_line_count(chart, 3, 0);
+    lv_obj_set_style_bg_color(chart, C_BG_DARK, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_obj_set_style_pad_all(chart, 2, 0);
+    lv_obj_set_style_size(chart, 0, 0, LV_PART_INDICATOR);   // no point markers
+    for (uint8_t p = 0; p < G.numPlayers; p++) {
+        lv_chart_series_t* ser = lv_chart_add_series(chart, _c(G.players[p].colour), LV_CHART_AXIS_PRIMARY_Y);
+        for (uint8_t i = 0; i < S.cashCount; i++) lv_chart_set_value_by_id(chart, ser, i, stats_cash(p, i));
+    }
+
+    // Top earning tiles
+    _mkLabel(scr, "Top rent", LV_ALIGN_TOP_LEFT, 212, 32, FONT_SM, C_TEXT_DIM);
+    uint8_t top[4];
+    uint8_t nTop = stats_topRentTiles(top, 4);
+    for (uint8_t i = 0; i < nTop; i++) {
+        snprintf(buf, sizeof(buf), "%.10s $%lu", TILES[top[i]].name, (unsigned long)S.rentByTile[top[i]]);
+        _mkLabel(scr, buf, LV_ALIGN_TOP_LEFT, 212, 48 + i * 16, FONT_SM, C_ACCENT);
+    }
+    if (!nTop) _mkLabel(scr, "none", LV_ALIGN_TOP_LEFT, 212, 48, FONT_SM, C_TEXT_DIM);
+
+    // Landings and turn times
+    snprintf(buf, sizeof(buf), "Most landed: %s", TILES[stats_mostLandedTile()].name);
+    _mkLabel(scr, buf, LV_ALIGN_TOP_LEFT, 8, 148, FONT_SM, C_TEXT);
+    snprintf(buf, sizeof(buf), "Turns: %u  avg %lus  max %lus", S.turns,
+             (unsigned long)(stats_avgTurnMs() / 1000), (unsigned long)(S.turnMaxMs / 1000));
+    _mkLabel(scr, buf, LV_ALIGN_TOP_LEFT, 8, 166, FONT_SM, C_TEXT);
+
+    _mkBtn(scr, "EXPORT", 20, 192, 130, 40, C_BTN_BG, _evStatsExport);
+    _mkBtn(scr, "BACK", 170, 192, 130, 40, C_BTN_ACTIVE, _evStatsBack);
+
+    _showScreen(scr);
+}
+
+// =============================================================================
+// ON-SCREEN KEYBOARD (async)
+// =============================================================================
+// A modal overlay on the top layer: the phase screen under it stays loaded
+// and the render loop keeps running. The keypad indev is lent to a group
+// holding only the keyboard (left / right pick a key, centre types it) and
+// handed back when the keyboard closes.
+#define KB_MAX_LEN  32
+
+static lv_obj_t*        _kbOverlay = nullptr;
+static lv_obj_t*        _kbArea    = nullptr;
+static lv_group_t*      _kbGroup   = nullptr;
+static lv_group_t*      _kbPrevGroup = nullptr;
+static ui_keyboard_cb_t _kbDone    = nullptr;
+static void*            _kbCtx     = nullptr;
+
+static lv_indev_t* _keypadIndev() {
+    for (lv_indev_t* i = lv_indev_get_next(nullptr); i; i = lv_indev_get_next(i)) {
+        if (lv_indev_get_type(i) == LV_INDEV_TYPE_KEYPAD) return i;
+    }
+    return nullptr;
+}
+
+static void _kbFinish(bool ok) {
+    char text[KB_MAX_LEN + 1];
+    strncpy(text, lv_textarea_get_text(_kbArea), KB_MAX_LEN);
+    text[KB_MAX_LEN] = '\0';
+
+    lv_indev_t* kp = _keypadIndev();
+    if (kp) lv_indev_set_group(kp, _kbPrevGroup);
+    lv_group_delete(_kbGroup);
+    // Called from the keyboard's own event: delete once it has returned
+    lv_obj_delete_async(_kbOverlay);
+    _kbOverlay = _kbArea = nullptr;
+    _kbGroup = _kbPrevGroup = nullptr;
+
+    // Cleared first so the callback may open the next keyboard
+    ui_keyboard_cb_t done = _kbDone;
+    void* ctx = _kbCtx;
+    _kbDone = nullptr;
+    _kbCtx  = nullptr;
+    if (done) done(ok && text[0] != '\0', text, ctx);
+}
+
+bool ui_keyboardAsync(const char* initial, uint8_t maxLen, const char* prompt,
+                      ui_keyboard_cb_t done, void* ctx) {
+    if (_kbOverlay) return false;
+    if (maxLen > KB_MAX_LEN) maxLen = KB_MAX_LEN;
+
+    // Full-screen and clickable, so touches never reach the screen below
+    _kbOverlay = lv_obj_create(lv_layer_top());
+    lv_obj_remove_style_all(_kbOverlay);
+    lv_obj_set_size(_kbOverlay, SCREEN_W, SCREEN_H);
+    lv_obj_set_style_bg_color(_kbOverlay, C_BG, 0);
+    lv_obj_set_style_bg_opa(_kbOverlay, LV_OPA_COVER, 0);
+    lv_obj_add_flag(_kbOverlay, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(_kbOverlay, LV_OBJ_FLAG_SCROLLABLE);
 
     // Prompt
-    _mkLabel(scr, prompt, LV_ALIGN_TOP_MID, 0, 5, FONT_MD, C_TEXT);
+    _mkLabel(_kbOverlay, prompt, LV_ALIGN_TOP_MID, 0, 5, FONT_MD, C_TEXT);
 
     // Text area
-    lv_obj_t* ta = lv_textarea_create(scr);
-    lv_textarea_set_max_length(ta, maxLen);
-    lv_textarea_set_one_line(ta, true);
-    lv_obj_set_size(ta, 300, 36);
-    lv_obj_align(ta, LV_ALIGN_TOP_MID, 0, 28);
-    lv_obj_set_style_text_color(ta, C_TEXT, 0);
-    lv_obj_set_style_text_font(ta, FONT_MD, 0);
-    if (strlen(buf) > 0) lv_textarea_set_text(ta, buf);
+    _kbArea = lv_textarea_create(_kbOverlay);
+    lv_textarea_set_max_length(_kbArea, maxLen);
+    lv_textarea_set_one_line(_kbArea, true);
+    lv_obj_set_size(_kbArea, 300, 36);
+    lv_obj_align(_kbArea, LV_ALIGN_TOP_MID, 0, 28);
+    theme_text(_kbArea, FONT_MD, C_TEXT);
+    if (initial && initial[0]) lv_textarea_set_text(_kbArea, initial);
 
     // Keyboard
-    lv_obj_t* kb = lv_keyboard_create(scr);
-    lv_keyboard_set_textarea(kb, ta);
+    lv_obj_t* kb = lv_keyboard_create(_kbOverlay);
+    lv_keyboard_set_textarea(kb, _kbArea);
     lv_obj_set_size(kb, SCREEN_W, 160);
     lv_obj_align(kb, LV_ALIGN_BOTTOM_MID, 0, 0);
 
-    _kbDone = false;
-
-    // Ready callback – fires on LV_KEY_ENTER from keyboard
+    // READY: the OK key; CANCEL: the close key
     lv_obj_add_event_cb(kb, [](lv_event_t* e) {
         lv_event_code_t code = lv_event_get_code(e);
-        if (code == LV_EVENT_READY || code == LV_EVENT_CANCEL) {
-            _kbDone = true;
-        }
+        if (code == LV_EVENT_READY)  _kbFinish(true);
+        if (code == LV_EVENT_CANCEL) _kbFinish(false);
     }, LV_EVENT_ALL, nullptr);
 
-    lv_screen_load(scr);
-
-    // Blocking loop
-    while (!_kbDone) {
-        lv_timer_handler();
-        hw_updateAudio();
-        BtnId btn = hw_readButtons();
-        if (btn == BTN_CENTER) _kbDone = true;
-        delay(5);
-    }
-
-    // Copy result
-    const char* result = lv_textarea_get_text(ta);
-    strncpy(buf, result, maxLen);
-    buf[maxLen] = '\0';
+    _kbGroup = lv_group_create();
+    lv_group_add_obj(_kbGroup, kb);
+    lv_indev_t* kp = _keypadIndev();
+    _kbPrevGroup = kp ? lv_indev_get_group(kp) : nullptr;
+    if (kp) lv_indev_set_group(kp, _kbGroup);
 
-    lv_obj_delete(scr);
-    return strlen(buf) > 0;
+    _kbDone = done;
+    _kbCtx  = ctx;
+    return true;
 }
 
 // =============================================================================
 // MASTER UI INIT / UPDATE
 // =============================================================================
 void ui_init() {
-    _initColors();
+    theme_init();
+    _poolStats.slots = UI_POOL_SLOTS;
     _prevPhase = (GamePhase)0xFF;
+    _initBindings();
     _initStatusOverlay();
     DBG_PRINT("UI init done (LVGL)");
 }
 
 void ui_update() {
+    // Card results from the NFC task
+    NfcResult r;
+    while (nfc_takeResult(r)) {
+        lv_display_trigger_activity(nullptr);      // a card on the reader counts as input
+        if (r.seq == _nfcSeq && _nfcHandler) _nfcHandler(r);
+    }
+
     // React to game state changes
     if (G.phase != _prevPhase || G.screenDirty) {
         GamePhase ph = G.phase;
@@ -1531,9 +1984,12 @@ void ui_update() {
             ph = G.phase;
             _prevPhase = ph;
         }
+        // Phase writes made here in the UI bypass game_setPhase()
+        if (lv_subject_get_int(&_subjects[GC_PHASE]) != ph) lv_subject_set_int(&_subjects[GC_PHASE], ph);
 
-        DBG("UI: phase -> %d", (int)ph);
-
+        uint32_t t0 = micros();
+        uint32_t heap0 = _heapUsed();
+        _heapLoaded = heap0;
         switch (ph) {
             case PHASE_SPLASH:         _buildSplash();       break;
             case PHASE_MENU:           _buildMenu();         break;
@@ -1550,8 +2006,22 @@ void ui_update() {
             case PHASE_PROGRAMMING:    _buildProgramming();  break;
             case PHASE_SETTINGS:       _buildSettings();     break;
             case PHASE_GAME_OVER:      _buildGameOver();     break;
+            case PHASE_GAME_STATS:     _buildGameStats();    break;
             default: break;
         }
+
+        // Build or refresh + load; the LVGL render follows in lv_timer_handler()
+        UiPoolStats& ps = _poolStats;
+        ps.lastSwitchUs = micros() - t0;
+        if (ps.lastSwitchUs > ps.maxSwitchUs) ps.maxSwitchUs = ps.lastSwitchUs;
+        _heapMonitor(ps.heapUsed, ps.fragPct);
+        if (ps.fragPct > ps.maxFragPct) ps.maxFragPct = ps.fragPct;
+        ps.screenBytes = (_heapLoaded > heap0) ? _heapLoaded - heap0 : 0;
+        if (ps.screenBytes > ps.maxScreenBytes) ps.maxScreenBytes = ps.screenBytes;
+        DBG("UI: phase -> %d %lu us, screen %lu B, heap %lu B frag %u%%, pool %lu hit %lu built %lu evicted",
+            (int)ph, (unsigned long)ps.lastSwitchUs, (unsigned long)ps.screenBytes,
+            (unsigned long)ps.heapUsed, ps.fragPct,
+            (unsigned long)ps.hits, (unsigned long)ps.builds, (unsigned long)ps.evictions);
     }
     _refreshStatusOverlay();
 }
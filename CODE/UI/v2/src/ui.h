@@ -8,9 +8,32 @@
 // UI ENTRY POINTS  (called from main loop)
 // =============================================================================
 void ui_init();
-void ui_update();           // Check game state, rebuild screens as needed
+void ui_update();           // Check game state, build or refresh the phase's screen
+
+// Screen switches: pooled screens reused / built / evicted, time from phase
+// change to screen loaded, LVGL heap the new screen took (0 on a pool hit)
+// and LVGL heap after the switch
+struct UiPoolStats {
+    uint8_t  slots;                 // UI_POOL_SLOTS (0: every screen built on entry)
+    uint32_t hits;
+    uint32_t builds;
+    uint32_t evictions;
+    uint32_t lastSwitchUs;
+    uint32_t maxSwitchUs;
+    uint32_t screenBytes;
+    uint32_t maxScreenBytes;
+    uint32_t heapUsed;
+    uint8_t  fragPct;
+    uint8_t  maxFragPct;
+};
+const UiPoolStats& ui_poolStats();
 
 // =============================================================================
-// ON-SCREEN KEYBOARD (blocking – runs its own LVGL loop)
+// ON-SCREEN KEYBOARD (async – returns at once, the render loop keeps running)
 // =============================================================================
-bool ui_keyboard(char* buf, uint8_t maxLen, const char* prompt);
+// done runs on the render task when the player confirms (ok, non-empty text)
+// or closes the keyboard (ok = false); text is only valid during the call.
+typedef void (*ui_keyboard_cb_t)(bool ok, const char* text, void* ctx);
+
+bool ui_keyboardAsync(const char* initial, uint8_t maxLen, const char* prompt,
+                      ui_keyboard_cb_t done, void* ctx = nullptr);   // false: one is open
@@ -0,0 +1,172 @@
+#include "ui_theme.h"
+
+lv_color_t C_BG, C_BG_DARK, C_PRIMARY, C_ACCENT, C_TEXT, C_TEXT_DIM;
+lv_color_t C_BTN_BG, C_BTN_ACTIVE, C_DANGER, C_WARN, C_HEADER;
+
+// Fonts with a shared style (the FONT_* sizes in ui.cpp)
+static const lv_font_t* const _fonts[] = {
+    &lv_font_montserrat_12, &lv_font_montserrat_16,
+    &lv_font_montserrat_20, &lv_font_montserrat_28,
+};
+#define _N_FONTS   (sizeof(_fonts) / sizeof(_fonts[0]))
+#define _N_TEXT    6        // text colours with a shared style
+#define _N_BTN     3        // button colours with a shared style
+
+static lv_style_t _screen, _header, _strip, _dot;
+static lv_style_t _font[_N_FONTS];
+static lv_color_t _textColor[_N_TEXT];
+static lv_style_t _text[_N_TEXT];
+static lv_style_t _btn, _btnPressed, _btnFocused;
+static lv_color_t _btnColor[_N_BTN];
+static lv_style_t _btnBg[_N_BTN], _btnBgPressed[_N_BTN];
+
+static int8_t _find(const lv_color_t* table, uint8_t n, lv_color_t c) {
+    for (uint8_t i = 0; i < n; i++) {
+        if (lv_color_eq(table[i], c)) return i;
+    }
+    return -1;
+}
+
+// Every property theme_init() puts in a style
+static const lv_style_prop_t _props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_BG_GRAD_COLOR, LV_STYLE_BG_GRAD_DIR,
+    LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM, LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT,
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_OPA, LV_STYLE_OUTLINE_WIDTH,
+    LV_STYLE_RADIUS, LV_STYLE_SHADOW_WIDTH, LV_STYLE_SHADOW_OPA, LV_STYLE_SHADOW_SPREAD,
+    LV_STYLE_TEXT_FONT, LV_STYLE_TEXT_COLOR,
+};
+
+static void _add(lv_obj_t* obj, const lv_style_t* style, lv_style_selector_t sel) {
+#if UI_THEME_SHARED
+    lv_obj_add_style(obj, style, sel);
+#else
+    for (lv_style_prop_t p : _props) {
+        lv_style_value_t v;
+        if (lv_style_get_prop(style, p, &v) == LV_STYLE_RES_FOUND) lv_obj_set_local_style_prop(obj, p, v, sel);
+    }
+#endif
+}
+
+// =============================================================================
+// INIT
+// =============================================================================
+void theme_init() {
+    C_BG         = lv_color_hex(0x000000);
+    C_BG_DARK    = lv_color_hex(0x101018);
+    C_PRIMARY    = lv_color_hex(0x00643C);
+    C_ACCENT     = lv_color_hex(0xFFC800);
+    C_TEXT       = lv_color_hex(0xFFFFFF);
+    C_TEXT_DIM   = lv_color_hex(0x7B7B7B);
+    C_BTN_BG     = lv_color_hex(0x282832);
+    C_BTN_ACTIVE = lv_color_hex(0x00B450);
+    C_DANGER     = lv_color_hex(0xDC2828);
+    C_WARN       = lv_color_hex(0xF0B400);
+    C_HEADER     = lv_color_hex(0x141423);
+
+    // Screen: theme artefacts (white border, padding) removed
+    lv_style_init(&_screen);
+    lv_style_set_bg_color(&_screen, C_BG);
+    lv_style_set_bg_opa(&_screen, LV_OPA_COVER);
+    lv_style_set_bg_grad_color(&_screen, C_BG_DARK);
+    lv_style_set_bg_grad_dir(&_screen, LV_GRAD_DIR_VER);
+    lv_style_set_pad_all(&_screen, 0);
+    lv_style_set_border_width(&_screen, 0);
+    lv_style_set_outline_width(&_screen, 0);
+
+    lv_style_init(&_header);
+    lv_style_set_bg_opa(&_header, LV_OPA_COVER);
+    lv_style_set_border_width(&_header, 1);
+
+    lv_style_init(&_strip);
+    lv_style_set_bg_color(&_strip, C_BG_DARK);
+    lv_style_set_bg_opa(&_strip, LV_OPA_COVER);
+    lv_style_set_radius(&_strip, 3);
+
+    lv_style_init(&_dot);
+    lv_style_set_bg_opa(&_dot, LV_OPA_COVER);
+    lv_style_set_radius(&_dot, LV_RADIUS_CIRCLE);
+
+    // Text: one style per font and per palette colour
+    for (uint8_t i = 0; i < _N_FONTS; i++) {
+        lv_style_init(&_font[i]);
+        lv_style_set_text_font(&_font[i], _fonts[i]);
+    }
+    const lv_color_t text[_N_TEXT] = { C_TEXT, C_TEXT_DIM, C_ACCENT, C_DANGER, C_WARN, C_BTN_ACTIVE };
+    for (uint8_t i = 0; i < _N_TEXT; i++) {
+        _textColor[i] = text[i];
+        lv_style_init(&_text[i]);
+        lv_style_set_text_color(&_text[i], text[i]);
+    }
+
+    // Buttons: border-based pressed / focused states draw inside the bounds
+    lv_style_init(&_btn);
+    lv_style_set_bg_opa(&_btn, LV_OPA_COVER);
+    lv_style_set_radius(&_btn, 10);
+    lv_style_set_shadow_width(&_btn, 8);
+    lv_style_set_shadow_opa(&_btn, LV_OPA_20);
+    lv_style_set_shadow_spread(&_btn, 1);
+    lv_style_set_border_width(&_btn, 2);
+    lv_style_set_border_opa(&_btn, LV_OPA_COVER);
+
+    lv_style_init(&_btnPressed);
+    lv_style_set_border_color(&_btnPressed, C_ACCENT);
+    lv_style_set_shadow_width(&_btnPressed, 0);
+
+    lv_style_init(&_btnFocused);
+    lv_style_set_border_color(&_btnFocused, C_ACCENT);
+
+    const lv_color_t btn[_N_BTN] = { C_BTN_BG, C_BTN_ACTIVE, C_DANGER };
+    for (uint8_t i = 0; i < _N_BTN; i++) {
+        _btnColor[i] = btn[i];
+        lv_style_init(&_btnBg[i]);
+        lv_style_set_bg_color(&_btnBg[i], btn[i]);
+        lv_style_set_border_color(&_btnBg[i], lv_color_darken(btn[i], 40));
+        lv_style_init(&_btnBgPressed[i]);
+        lv_style_set_bg_color(&_btnBgPressed[i], lv_color_lighten(btn[i], 40));
+    }
+}
+
+// =============================================================================
+// APPLY
+// =============================================================================
+void theme_screen(lv_obj_t* scr) {
+    _add(scr, &_screen, 0);
+}
+
+void theme_button(lv_obj_t* btn, lv_color_t bg) {
+    _add(btn, &_btn, 0);
+    _add(btn, &_btnPressed, LV_STATE_PRESSED);
+    _add(btn, &_btnFocused, LV_STATE_FOCUSED);
+    int8_t i = _find(_btnColor, _N_BTN, bg);
+    if (i >= 0) {
+        _add(btn, &_btnBg[i], 0);
+        _add(btn, &_btnBgPressed[i], LV_STATE_PRESSED);
+    } else {
+        lv_obj_set_style_bg_color(btn, bg, 0);
+        lv_obj_set_style_border_color(btn, lv_color_darken(bg, 40), 0);
+        lv_obj_set_style_bg_color(btn, lv_color_lighten(bg, 40), LV_STATE_PRESSED);
+    }
+}
+
+void theme_text(lv_obj_t* lbl, const lv_font_t* font, lv_color_t color) {
+    uint8_t f = 0;
+    while (f < _N_FONTS && _fonts[f] != font) f++;
+    if (f < _N_FONTS) _add(lbl, &_font[f], 0);
+    else              lv_obj_set_style_text_font(lbl, font, 0);
+
+    int8_t c = _find(_textColor, _N_TEXT, color);
+    if (c >= 0) _add(lbl, &_text[c], 0);
+    else        lv_obj_set_style_text_color(lbl, color, 0);
+}
+
+void theme_header(lv_obj_t* bar) {
+    _add(bar, &_header, 0);
+}
+
+void theme_strip(lv_obj_t* obj) {
+    _add(obj, &_strip, 0);
+}
+
+void theme_dot(lv_obj_t* obj) {
+    _add(obj, &_dot, 0);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+#include "config.h"
+
+// =============================================================================
+// THEME  (palette + shared LVGL styles)
+// =============================================================================
+// Styles are added to widgets by reference, so each property is stored once
+// in LVGL's heap however many widgets use it. Palette colours get a shared
+// style; any other colour (player tokens, one-off shades) stays a local style
+// on the widget.
+//
+// UI_THEME_SHARED=0 copies the same properties into each widget's local
+// styles instead (the baseline for the heap / frag figures in ui_bench.json).
+#ifndef UI_THEME_SHARED
+  #define UI_THEME_SHARED  1
+#endif
+
+extern lv_color_t C_BG, C_BG_DARK, C_PRIMARY, C_ACCENT, C_TEXT, C_TEXT_DIM;
+extern lv_color_t C_BTN_BG, C_BTN_ACTIVE, C_DANGER, C_WARN, C_HEADER;
+
+void theme_init();                                  // palette + styles, before any widget
+
+void theme_screen(lv_obj_t* scr);                   // gradient background, no padding / border
+void theme_button(lv_obj_t* btn, lv_color_t bg);    // shape, pressed / focused states, colour
+void theme_text(lv_obj_t* lbl, const lv_font_t* font, lv_color_t color);
+void theme_header(lv_obj_t* bar);                   // opaque bar with a 1 px border
+void theme_strip(lv_obj_t* obj);                    // dark rounded info strip
+void theme_dot(lv_obj_t* obj);                      // filled circle, colour set by the caller
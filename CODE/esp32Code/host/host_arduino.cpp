@@ -0,0 +1,46 @@
+#include <Arduino.h>
+#include <SPI.h>
+#include <Wire.h>
+
+#include <chrono>
+
+#include "host_panel.h"
+
+HostSerial Serial;
+HostSerial Serial0;
+SPIClass SPI;
+TwoWire Wire;
+
+namespace {
+uint32_t gMillis = 0;
+uint32_t gRandom = 1;
+const auto gStart = std::chrono::steady_clock::now();
+}  // namespace
+
+// millis() is a virtual clock the bench steps, so frames are reproducible;
+// micros() is wall time, so render costs are real.
+void host_setMillis(uint32_t ms) { gMillis = ms; }
+uint32_t millis() { return gMillis; }
+uint32_t micros() {
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - gStart).count());
+}
+void delay(uint32_t ms) { gMillis += ms; }
+void delayMicroseconds(uint32_t) {}
+
+void pinMode(int, int) {}
+void digitalWrite(int pin, int level) {
+  if (pin == PIN_TFT_DC) hostPanel.setDataMode(level != LOW);
+}
+int digitalRead(int) { return HIGH; }
+int analogRead(int) { return 0; }
+
+void host_spi_byte(uint8_t b) { hostPanel.byte(b); }
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  gRandom = gRandom * 1103515245u + 12345u;
+  return (gRandom >> 16) % howbig;
+}
+long random(long howsmall, long howbig) { return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall); }
+void randomSeed(unsigned long seed) { gRandom = seed ? seed : 1; }
@@ -0,0 +1,37 @@
+#include "host_cards.h"
+
+PlayerCardData hostPlayerCard;
+PropertyCardData hostPropertyCard;
+EventCardData hostEventCard;
+
+NfcCardType CardManager::detectType(const CardTap &tap) { return tap.type; }
+
+bool CardManager::readPlayer(const CardTap &, PlayerCardData &out) {
+  out = hostPlayerCard;
+  return true;
+}
+
+bool CardManager::readProperty(const CardTap &, PropertyCardData &out) {
+  out = hostPropertyCard;
+  return true;
+}
+
+bool CardManager::readEvent(const CardTap &, EventCardData &out) {
+  out = hostEventCard;
+  return true;
+}
+
+bool CardManager::writePlayer(const CardTap &, const PlayerCardData &data) {
+  hostPlayerCard = data;
+  return true;
+}
+
+bool CardManager::writeProperty(const CardTap &, const PropertyCardData &data) {
+  hostPropertyCard = data;
+  return true;
+}
+
+bool CardManager::writeEvent(const CardTap &, const EventCardData &data) {
+  hostEventCard = data;
+  return true;
+}
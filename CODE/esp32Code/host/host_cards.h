@@ -0,0 +1,8 @@
+#pragma once
+
+#include "card_manager.h"
+
+// Card contents returned by the next CardManager read on the host
+extern PlayerCardData hostPlayerCard;
+extern PropertyCardData hostPropertyCard;
+extern EventCardData hostEventCard;
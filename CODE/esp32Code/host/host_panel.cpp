@@ -0,0 +1,139 @@
+#include "host_panel.h"
+
+#include <vector>
+
+namespace {
+constexpr uint8_t kCaset = 0x2A;
+constexpr uint8_t kRaset = 0x2B;
+constexpr uint8_t kRamwr = 0x2C;
+
+uint32_t crc32(const uint8_t *p, size_t n, uint32_t crc = 0) {
+  crc = ~crc;
+  while (n--) {
+    crc ^= *p++;
+    for (uint8_t k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+void put32(std::vector<uint8_t> &v, uint32_t x) {
+  v.push_back(x >> 24);
+  v.push_back(x >> 16);
+  v.push_back(x >> 8);
+  v.push_back(x);
+}
+
+void chunk(FILE *f, const char *type, const std::vector<uint8_t> &data) {
+  std::vector<uint8_t> buf;
+  put32(buf, data.size());
+  buf.insert(buf.end(), type, type + 4);
+  buf.insert(buf.end(), data.begin(), data.end());
+  put32(buf, crc32(buf.data() + 4, buf.size() - 4));
+  fwrite(buf.data(), 1, buf.size(), f);
+}
+}  // namespace
+
+HostPanel hostPanel;
+
+void HostPanel::byte(uint8_t b) {
+  stats.spiBytes++;
+  if (!data_) {
+    stats.commands++;
+    cmd_ = b;
+    argLen_ = 0;
+    haveHi_ = false;
+    if (cmd_ == kRamwr) {
+      stats.windows++;
+      cx_ = xs_;
+      cy_ = ys_;
+    }
+    return;
+  }
+
+  if (cmd_ == kCaset || cmd_ == kRaset) {
+    if (argLen_ < 4) arg_[argLen_++] = b;
+    if (argLen_ == 4) {
+      const uint16_t s = (arg_[0] << 8) | arg_[1];
+      const uint16_t e = (arg_[2] << 8) | arg_[3];
+      if (cmd_ == kCaset) {
+        xs_ = s;
+        xe_ = e;
+      } else {
+        ys_ = s;
+        ye_ = e;
+      }
+    }
+    return;
+  }
+
+  if (cmd_ != kRamwr) return;
+  if (!haveHi_) {
+    hi_ = b;
+    haveHi_ = true;
+    return;
+  }
+  haveHi_ = false;
+  stats.pixels++;
+  if (cx_ < SCREEN_W && cy_ < SCREEN_H) fb_[cy_ * SCREEN_W + cx_] = (hi_ << 8) | b;
+  if (cx_++ >= xe_) {
+    cx_ = xs_;
+    if (cy_++ >= ye_) cy_ = ys_;
+  }
+}
+
+uint64_t HostPanel::hash() const {
+  uint64_t h = 0xcbf29ce484222325ull;
+  for (uint32_t i = 0; i < SCREEN_W * SCREEN_H; i++) {
+    h = (h ^ (fb_[i] & 0xFF)) * 0x100000001b3ull;
+    h = (h ^ (fb_[i] >> 8)) * 0x100000001b3ull;
+  }
+  return h;
+}
+
+// 8-bit RGB PNG with stored (uncompressed) deflate blocks: no zlib needed
+bool HostPanel::writePng(const char *path) const {
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  fwrite(sig, 1, sizeof(sig), f);
+
+  std::vector<uint8_t> ihdr;
+  put32(ihdr, SCREEN_W);
+  put32(ihdr, SCREEN_H);
+  ihdr.insert(ihdr.end(), {8, 2, 0, 0, 0});  // 8-bit RGB, no interlace
+  chunk(f, "IHDR", ihdr);
+
+  std::vector<uint8_t> raw;
+  raw.reserve(SCREEN_H * (1 + SCREEN_W * 3));
+  for (uint16_t y = 0; y < SCREEN_H; y++) {
+    raw.push_back(0);  // filter: none
+    for (uint16_t x = 0; x < SCREEN_W; x++) {
+      const uint16_t c = fb_[y * SCREEN_W + x];
+      const uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+      raw.push_back((r << 3) | (r >> 2));
+      raw.push_back((g << 2) | (g >> 4));
+      raw.push_back((b << 3) | (b >> 2));
+    }
+  }
+
+  std::vector<uint8_t> z = {0x78, 0x01};
+  uint32_t a = 1, s2 = 0;
+  for (uint8_t v : raw) {
+    a = (a + v) % 65521;
+    s2 = (s2 + a) % 65521;
+  }
+  for (size_t off = 0; off < raw.size();) {
+    const uint16_t n = static_cast<uint16_t>(std::min<size_t>(65535, raw.size() - off));
+    z.push_back(off + n == raw.size() ? 1 : 0);
+    z.push_back(n & 0xFF);
+    z.push_back(n >> 8);
+    z.push_back(~n & 0xFF);
+    z.push_back((~n >> 8) & 0xFF);
+    z.insert(z.end(), raw.begin() + off, raw.begin() + off + n);
+    off += n;
+  }
+  put32(z, (s2 << 16) | a);
+  chunk(f, "IDAT", z);
+  chunk(f, "IEND", {});
+  return fclose(f) == 0;
+}
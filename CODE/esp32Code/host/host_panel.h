@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "config.h"
+
+// ST7789 as seen from the SPI bus: decodes CASET / RASET / RAMWR from the
+// byte stream the real Adafruit driver produces and keeps the resulting
+// SCREEN_W x SCREEN_H RGB565 image. Window coordinates are the driver's
+// rotated ones, so the image is what the player sees; MADCTL is ignored.
+class HostPanel {
+ public:
+  struct Stats {
+    uint32_t spiBytes = 0;  // everything clocked out, commands included
+    uint32_t commands = 0;
+    uint32_t windows = 0;   // RAMWR commands
+    uint32_t pixels = 0;    // pixels written by RAMWR
+  };
+
+  void setDataMode(bool data) { data_ = data; }
+  void byte(uint8_t b);
+
+  const uint16_t *pixels() const { return fb_; }
+  uint64_t hash() const;  // FNV-1a over the image
+  bool writePng(const char *path) const;
+
+  Stats stats{};
+
+ private:
+  uint16_t fb_[SCREEN_W * SCREEN_H] = {};
+  bool data_ = true;
+  uint8_t cmd_ = 0;
+  uint8_t arg_[4] = {};
+  uint8_t argLen_ = 0;
+  uint16_t xs_ = 0, xe_ = 0, ys_ = 0, ye_ = 0;
+  uint16_t cx_ = 0, cy_ = 0;
+  uint8_t hi_ = 0;
+  bool haveHi_ = false;
+};
+
+extern HostPanel hostPanel;
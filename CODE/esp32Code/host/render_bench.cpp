@@ -0,0 +1,286 @@
+// Host render bench: drives GameLogic + DisplayUi through every screen on a
+// simulated ST7789, checks each frame against golden hashes and reports
+// per-screen drawing cost as JSON on stdout.
+//
+//   render_bench [--golden FILE] [--update] [--png DIR] [--no-glyph-cache]
+//
+// Exit code is non-zero when a frame differs from its golden hash or a game
+// frame is rendered from a state other than the one the script expects.
+
+#include <Arduino.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "display_ui.h"
+#include "game_logic.h"
+#include "host_cards.h"
+#include "host_panel.h"
+
+void host_setMillis(uint32_t ms);
+
+namespace {
+struct Result {
+  std::string name;
+  RenderStats render;
+  HostPanel::Stats spi;
+  FrameCanvas::TextStats text;
+  uint32_t wallUs;
+  uint64_t hash;
+  const char *golden;
+};
+
+Adafruit_PN532 gNfc;
+CardManager gCards(gNfc);
+TimerWheel gTimers;
+GameLogic gGame;
+DisplayUi gUi;
+uint32_t gNow = 1000;
+std::vector<Result> gResults;
+int gStateErrors = 0;
+const char *gPngDir = nullptr;
+
+// Steps the virtual clock and fires the game deadlines it passed
+void advance(uint32_t ms) {
+  gNow += ms;
+  host_setMillis(gNow);
+  gTimers.run(gNow);
+}
+
+void tapPlayer(uint8_t id, int32_t balance) {
+  CardTap tap;
+  tap.valid = true;
+  tap.type = NfcCardType::PLAYER;
+  hostPlayerCard = PlayerCardData{};
+  hostPlayerCard.playerId = id;
+  hostPlayerCard.balance = balance;
+  gGame.onPlayerCard(tap, gCards);
+}
+
+void tapProperty(uint8_t id) {
+  CardTap tap;
+  tap.valid = true;
+  tap.type = NfcCardType::PROPERTY;
+  hostPropertyCard = PropertyCardData{};
+  hostPropertyCard.propertyId = id;
+  gGame.onPropertyCard(tap, gCards);
+}
+
+void tapEvent(uint8_t id) {
+  CardTap tap;
+  tap.valid = true;
+  tap.type = NfcCardType::EVENT;
+  hostEventCard = EventCardData{};
+  hostEventCard.eventId = id;
+  gGame.onEventCard(tap, gCards);
+}
+
+// Renders one step and records what it cost
+template <typename Fn>
+void frame(const char *name, Fn draw) {
+  hostPanel.stats = HostPanel::Stats{};
+  const auto t0 = std::chrono::steady_clock::now();
+  draw();
+  const auto t1 = std::chrono::steady_clock::now();
+  Result r;
+  r.name = name;
+  r.render = gUi.lastRender();
+  r.spi = hostPanel.stats;
+  r.text = gUi.lastText();
+  r.wallUs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+  r.hash = hostPanel.hash();
+  r.golden = "new";
+  gResults.push_back(r);
+  if (gPngDir) {
+    const std::string path = std::string(gPngDir) + "/" + name + ".png";
+    if (!hostPanel.writePng(path.c_str())) fprintf(stderr, "cannot write %s\n", path.c_str());
+  }
+}
+
+// Renders the game's current screen; the script must have reached `expected`
+// first or the frame would silently hash the wrong scene
+void render(const char *name, UiState expected) {
+  if (gGame.state() != expected) {
+    fprintf(stderr, "%s: state %u, expected %u\n", name, static_cast<unsigned>(gGame.state()),
+            static_cast<unsigned>(expected));
+    gStateErrors++;
+  }
+  frame(name, [] {
+    gUi.render(gGame, 87.0f);
+    gGame.clearDirty();
+  });
+}
+
+// Buys `prop`, then loses an event card with no cash left: bankrupt.
+void bankrupt(uint8_t player, uint8_t prop) {
+  gGame.primePlayer(player, 200);
+  tapProperty(prop);
+  gGame.onBtn1();
+  tapPlayer(player, 0);
+  gGame.primePlayer(player, 0);
+  tapEvent(6);
+  advance(900);
+  tapPlayer(player, 0);
+  tapProperty(prop);
+}
+
+void runScript() {
+  const PlayerMask lobby = playerBit(1) | playerBit(2) | playerBit(3);
+  frame("lobby", [&] { gUi.renderLobby(3, 4, lobby, false, "ready"); });
+  frame("programming", [] { gUi.renderProgramming("PLAYER", 2, "balance 1500", true, "written"); });
+  frame("action_menu", [] { gUi.renderActionMenu(1); });
+
+  for (uint8_t id = 1; id <= 4; id++) gGame.primePlayer(id, 1500);
+  render("home", UiState::HOME);
+  render("home_idle", UiState::HOME);
+  gGame.primePlayer(2, 1350);
+  gGame.primePlayer(3, 1650);
+  render("home_balance", UiState::HOME);
+
+  tapProperty(5);
+  render("property_unowned", UiState::PROPERTY_UNOWNED);
+  gGame.onBtn1();
+  render("wait_buy", UiState::WAIT_CARD);
+  advance(130);
+  frame("wait_anim", [] { gUi.animate(gNow, ANIM_BUDGET_US); });
+  tapPlayer(1, 0);
+  render("home_purchase", UiState::HOME);
+
+  tapProperty(5);
+  render("property_owned", UiState::PROPERTY_OWNED);
+  gGame.onBtn1();
+  tapPlayer(2, 0);
+  render("home_rent", UiState::HOME);
+
+  tapProperty(9);
+  gGame.onBtn3();
+  render("auction", UiState::AUCTION);
+  advance(1000);
+  render("auction_tick", UiState::AUCTION);
+  gGame.onBtn2();
+  render("home_back", UiState::HOME);
+
+  // Eight players: two-column grid
+  for (uint8_t id = 5; id <= GAME_MAX_PLAYERS; id++) gGame.primePlayer(id, 1500);
+  render("home_8p", UiState::HOME);
+  gGame.primePlayer(7, 1450);
+  render("home_8p_balance", UiState::HOME);
+
+  tapEvent(1);
+  render("event", UiState::EVENT);
+  gGame.onBtn2();
+  gGame.primePlayer(4, 50);
+  tapEvent(6);
+  advance(900);
+  tapPlayer(4, 0);
+  render("debt", UiState::DEBT);
+  gGame.onBtn2();
+  gGame.primePlayer(4, 1500);
+
+  gGame.triggerMenuAction(0);
+  render("go", UiState::GO);
+  gGame.triggerMenuAction(1);
+  gGame.onBtn2();
+  gGame.triggerMenuAction(1);
+  render("jail", UiState::JAIL);
+  gGame.onBtn2();
+  gGame.triggerMenuAction(2);
+  render("train", UiState::TRAIN);
+  gGame.onBtn2();
+
+  bankrupt(2, 1);
+  bankrupt(3, 2);
+  bankrupt(4, 3);
+  for (uint8_t id = 5; id <= GAME_MAX_PLAYERS; id++) bankrupt(id, 5 + id);
+  render("winner", UiState::WINNER);
+}
+
+std::map<std::string, uint64_t> loadGolden(const char *path) {
+  std::map<std::string, uint64_t> golden;
+  FILE *f = fopen(path, "r");
+  if (!f) return golden;
+  char name[64];
+  unsigned long long h;
+  while (fscanf(f, "%63s %llx", name, &h) == 2) golden[name] = h;
+  fclose(f);
+  return golden;
+}
+
+bool saveGolden(const char *path) {
+  FILE *f = fopen(path, "w");
+  if (!f) return false;
+  for (const Result &r : gResults) fprintf(f, "%s %016llx\n", r.name.c_str(), static_cast<unsigned long long>(r.hash));
+  return fclose(f) == 0;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const char *goldenPath = "host/golden.txt";
+  bool update = false;
+  bool glyphCache = true;
+  for (int i = 1; i < argc; i++) {
+    const std::string a = argv[i];
+    if (a == "--golden" && i + 1 < argc) {
+      goldenPath = argv[++i];
+    } else if (a == "--png" && i + 1 < argc) {
+      gPngDir = argv[++i];
+    } else if (a == "--update") {
+      update = true;
+    } else if (a == "--no-glyph-cache") {
+      glyphCache = false;
+    } else {
+      fprintf(stderr, "usage: %s [--golden FILE] [--update] [--png DIR] [--no-glyph-cache]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  host_setMillis(gNow);
+  gUi.begin();
+  gUi.setGlyphCache(glyphCache);
+  gNow = millis();  // panel init delays advance the virtual clock
+  gTimers.begin(gNow);
+  gGame.begin(gTimers);
+  runScript();
+
+  const std::map<std::string, uint64_t> golden = loadGolden(goldenPath);
+  int mismatches = 0;
+  for (Result &r : gResults) {
+    const auto it = golden.find(r.name);
+    if (it == golden.end()) continue;
+    r.golden = it->second == r.hash ? "ok" : "mismatch";
+    if (it->second != r.hash) mismatches++;
+  }
+
+  printf("{\n  \"framebuffer\": %s,\n  \"glyphCache\": %s,\n  \"screens\": [\n", TFT_FRAMEBUFFER ? "true" : "false",
+         glyphCache ? "true" : "false");
+  RenderStats total;
+  uint64_t spiTotal = 0;
+  for (size_t i = 0; i < gResults.size(); i++) {
+    const Result &r = gResults[i];
+    printf("    {\"name\": \"%s\", \"windows\": %u, \"pixels\": %u, \"bytes\": %u, \"spiBytes\": %u, "
+           "\"textChars\": %u, \"textUs\": %u, \"wallUs\": %u, \"hash\": \"%016llx\", \"golden\": \"%s\"}%s\n",
+           r.name.c_str(), r.render.windows, r.render.pixels, r.render.bytes, r.spi.spiBytes, r.text.chars,
+           r.text.micros, r.wallUs, static_cast<unsigned long long>(r.hash), r.golden,
+           i + 1 < gResults.size() ? "," : "");
+    total.windows += r.render.windows;
+    total.pixels += r.render.pixels;
+    total.bytes += r.render.bytes;
+    spiTotal += r.spi.spiBytes;
+  }
+  printf("  ],\n  \"total\": {\"windows\": %u, \"pixels\": %u, \"bytes\": %u, \"spiBytes\": %llu, \"mismatches\": %d, "
+         "\"stateErrors\": %d}\n}\n",
+         total.windows, total.pixels, total.bytes, static_cast<unsigned long long>(spiTotal), mismatches, gStateErrors);
+  if (gStateErrors) return 1;  // never write goldens for the wrong scenes
+
+  if (update) {
+    if (!saveGolden(goldenPath)) {
+      fprintf(stderr, "cannot write %s\n", goldenPath);
+      return 1;
+    }
+    fprintf(stderr, "golden: wrote %u frames to %s\n", static_cast<unsigned>(gResults.size()), goldenPath);
+    return 0;
+  }
+  return mismatches ? 1 : 0;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// The render bench feeds card taps from host_cards.cpp; no PN532 on the host.
+
+#include <Arduino.h>
+
+class Adafruit_PN532 {};
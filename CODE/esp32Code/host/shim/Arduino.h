@@ -0,0 +1,160 @@
+#pragma once
+
+// Minimal Arduino core for the host render bench. Enough for Adafruit_GFX,
+// the ST77xx driver and the DisplayUi / GameLogic sources; GPIO and timing go
+// through host_arduino.cpp so the bench controls the clock and the panel.
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+
+using std::max;
+using std::min;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+#define PI 3.1415926535897932384626433832795
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define IRAM_ATTR
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+class __FlashStringHelper;
+
+class String {
+ public:
+  String(const char *s = "") : s_(s ? s : "") {}
+  const char *c_str() const { return s_.c_str(); }
+  unsigned int length() const { return static_cast<unsigned int>(s_.size()); }
+
+ private:
+  std::string s_;
+};
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int level);
+int digitalRead(int pin);
+int analogRead(int pin);
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+inline void yield() {}
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char *str) { return str ? write(reinterpret_cast<const uint8_t *>(str), strlen(str)) : 0; }
+  size_t write(const char *buffer, size_t size) { return write(reinterpret_cast<const uint8_t *>(buffer), size); }
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(const String &s) { return write(s.c_str()); }
+  size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+  size_t print(unsigned char v, int base = DEC) { return print(static_cast<unsigned long>(v), base); }
+  size_t print(int v, int base = DEC) { return print(static_cast<long>(v), base); }
+  size_t print(unsigned int v, int base = DEC) { return print(static_cast<unsigned long>(v), base); }
+  size_t print(long v, int base = DEC) {
+    if (base == DEC && v < 0) return print('-') + printNumber(static_cast<unsigned long>(-v), base);
+    return printNumber(static_cast<unsigned long>(v), base);
+  }
+  size_t print(unsigned long v, int base = DEC) { return printNumber(v, base); }
+  size_t print(double v, int digits = 2) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", digits, v);
+    return write(buf);
+  }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T>
+  size_t println(T v) {
+    const size_t n = print(v);
+    return n + println();
+  }
+  template <typename T>
+  size_t println(T v, int f) {
+    const size_t n = print(v, f);
+    return n + println();
+  }
+
+  size_t printf(const char *fmt, ...) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    const int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return n > 0 ? write(buf) : 0;
+  }
+
+ private:
+  size_t printNumber(unsigned long n, int base) {
+    char buf[8 * sizeof(long) + 1];
+    char *p = &buf[sizeof(buf) - 1];
+    *p = '\0';
+    if (base < 2) base = 10;
+    do {
+      const char c = static_cast<char>(n % base);
+      n /= base;
+      *--p = c < 10 ? c + '0' : c + 'A' - 10;
+    } while (n);
+    return write(p);
+  }
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  virtual int peek() { return -1; }
+};
+
+// Serial goes to stderr so stdout stays clean for the JSON report
+class HostSerial : public Stream {
+ public:
+  void begin(unsigned long) {}
+  void flush() {}
+  explicit operator bool() const { return true; }
+  size_t write(uint8_t c) override { return fputc(c, stderr) == EOF ? 0 : 1; }
+  using Print::write;
+};
+
+extern HostSerial Serial;
+extern HostSerial Serial0;
@@ -0,0 +1,50 @@
+#pragma once
+
+// Host SPI bus: every byte the display driver clocks out is handed to
+// host_spi_byte(), where the ST7789 model in host_panel.cpp decodes it.
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+#define SPI_HAS_TRANSACTION 1
+
+enum BitOrder { LSBFIRST = 0, MSBFIRST = 1 };
+
+void host_spi_byte(uint8_t b);
+
+class SPISettings {
+ public:
+  SPISettings() {}
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+ public:
+  void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+  void end() {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction() {}
+  void setBitOrder(uint8_t) {}
+  void setDataMode(uint8_t) {}
+  void setFrequency(uint32_t) {}
+  void setClockDivider(uint32_t) {}
+
+  uint8_t transfer(uint8_t b) {
+    host_spi_byte(b);
+    return 0;
+  }
+  uint16_t transfer16(uint16_t w) {
+    host_spi_byte(w >> 8);
+    host_spi_byte(w);
+    return 0;
+  }
+  void transfer(void *buf, size_t count) {
+    const uint8_t *p = static_cast<const uint8_t *>(buf);
+    while (count--) host_spi_byte(*p++);
+  }
+};
+
+extern SPIClass SPI;
@@ -0,0 +1,19 @@
+#pragma once
+
+// I2C is not used by the render bench; this only satisfies Adafruit BusIO.
+
+#include <Arduino.h>
+
+class TwoWire : public Stream {
+ public:
+  bool begin(int = -1, int = -1, uint32_t = 0) { return true; }
+  void end() {}
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool = true) { return 2; }  // NACK: nothing on the bus
+  size_t requestFrom(uint8_t, size_t, bool = true) { return 0; }
+  size_t write(uint8_t) override { return 1; }
+  using Print::write;
+};
+
+extern TwoWire Wire;
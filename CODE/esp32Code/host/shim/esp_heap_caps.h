@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+// The host has no PSRAM, so the framebuffer lands in "internal" RAM
+inline void *heap_caps_malloc(size_t size, unsigned caps) {
+  return (caps & MALLOC_CAP_SPIRAM) ? nullptr : malloc(size);
+}
+inline void heap_caps_free(void *p) { free(p); }
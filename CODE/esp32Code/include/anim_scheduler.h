@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Frame-paced animation for screen regions. A screen registers each animated
+// region with a period and a draw callback; run() draws whatever is due,
+// oldest deadline first, and stops once the per-call time budget is spent so
+// the main loop gets back to buttons and NFC. A region that fell more than a
+// period behind draws once with its frame counter advanced past the skipped
+// frames (coalesced) and the skips are counted as missed deadlines.
+class AnimScheduler {
+ public:
+  static constexpr uint8_t MAX_REGIONS = 6;
+
+  // frame counts periods since add(), so phase = frame % n is stable
+  using DrawFn = void (*)(void *ctx, uint32_t frame);
+
+  struct Stats {
+    uint32_t frames = 0;     // run() calls that drew something
+    uint32_t draws = 0;      // region callbacks
+    uint32_t missed = 0;     // periods skipped because a region ran late
+    uint32_t deferred = 0;   // due regions pushed to the next run() by the budget
+    uint32_t lastFrameUs = 0;
+    uint32_t maxFrameUs = 0;
+  };
+
+  int8_t add(uint16_t periodMs, DrawFn draw, void *ctx);  // -1 = full
+  void remove(int8_t id);
+  void clear();
+  bool empty() const { return count_ == 0; }
+
+  bool run(uint32_t nowMs, uint32_t budgetUs);  // true = something was drawn
+  uint32_t nextDueMs() const;                   // UINT32_MAX when empty
+
+  const Stats &stats() const { return stats_; }
+  void resetStats() { stats_ = Stats{}; }
+
+ private:
+  struct Region {
+    DrawFn draw = nullptr;
+    void *ctx = nullptr;
+    uint16_t periodMs = 0;
+    uint32_t dueMs = 0;
+    uint32_t frame = 0;
+  };
+
+  Region regions_[MAX_REGIONS];
+  uint8_t count_ = 0;
+  Stats stats_{};
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Boot timeline. setup() marks each stage as it finishes; slow peripherals go
+// to spawn(), which brings them up on core 0 while the display starts on the
+// loop core. report() prints the timeline once every spawned task has ended
+// and warns when the last stage landed after BOOT_BUDGET_MS.
+class BootTrace {
+ public:
+  static constexpr uint8_t MAX_STAGES = 16;
+  static constexpr uint8_t MAX_TASKS = 2;
+
+  using TaskFn = void (*)(void *ctx);
+  using LineFn = void (*)(const char *line);
+
+  void mark(const char *stage);                       // any task
+  void spawn(const char *name, TaskFn fn, void *ctx);  // marks `name` when fn returns
+  bool done() const { return pending_ == 0; }
+  bool report(LineFn emit);                           // true on the call that printed
+
+ private:
+  struct Stage {
+    const char *name = nullptr;
+    uint32_t us = 0;  // micros() since reset
+    uint8_t core = 0;
+  };
+
+  struct Task {
+    BootTrace *owner = nullptr;
+    const char *name = nullptr;
+    TaskFn fn = nullptr;
+    void *ctx = nullptr;
+  };
+
+  static void taskMain(void *arg);
+  void finish(const Task &task);
+
+  Stage stages_[MAX_STAGES];
+  uint8_t count_ = 0;
+  Task tasks_[MAX_TASKS];
+  uint8_t taskCount_ = 0;
+  volatile uint8_t pending_ = 0;
+  bool reported_ = false;
+  portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+};
@@ -5,11 +5,16 @@
 #include "config.h"
 #include "game_types.h"
 
+// seq counts the record's changes within gameId; the higher seq of the same
+// game wins when the card and the board disagree. Cards written before
+// version 2 read as seq 0, game 0.
 struct PlayerCardData {
   uint8_t playerId = 0;
   int32_t balance = 1500;
   uint8_t jailed = 0;
   uint8_t bankrupt = 0;
+  uint16_t seq = 0;
+  uint8_t gameId = 0;
 };
 
 struct PropertyCardData {
@@ -17,6 +22,8 @@ struct PropertyCardData {
   uint8_t ownerId = 0;
   uint8_t level = 1;
   uint16_t basePrice = 0;
+  uint16_t seq = 0;
+  uint8_t gameId = 0;
 };
 
 struct EventCardData {
@@ -25,6 +32,9 @@ struct EventCardData {
   int16_t value = 0;
 };
 
+// Within one tap, every record block read is kept and its sector stays
+// authenticated, so detectType(), the reads after it and a write-back to the
+// same card cost one authentication and one block read.
 class CardManager {
  public:
   explicit CardManager(Adafruit_PN532 &nfc) : nfc_(nfc) {}
@@ -41,9 +51,16 @@ class CardManager {
   bool writeEvent(const CardTap &tap, const EventCardData &data);
 
  private:
+  static constexpr uint8_t NO_SECTOR = 0xFF;
+
   bool auth(const CardTap &tap, uint8_t block);
-  bool readBlock(uint8_t block, uint8_t out[16]);
+  bool readBlock(const CardTap &tap, uint8_t block, uint8_t out[16]);
   bool writeBlock(uint8_t block, const uint8_t in[16]);
+  void forget();
 
   Adafruit_PN532 &nfc_;
+  uint16_t tapSerial_ = 0;           // tap the state below belongs to
+  uint8_t authSector_ = NO_SECTOR;   // sector the reader holds auth for
+  uint8_t cachedBlock_ = 0;          // 0 = none
+  uint8_t cache_[16] = {0};
 };
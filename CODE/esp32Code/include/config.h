@@ -85,6 +85,28 @@
   #define TFT_ROTATE_180 1
 #endif
 
+// Red/green/blue full-screen fills at boot (+360 ms) to check the panel
+#ifndef DISPLAY_SELFTEST
+  #define DISPLAY_SELFTEST 0
+#endif
+
+// Collect each frame in row-band buffers and push only the rects that were
+// painted (see frame_canvas.h). 0 = draw to the panel.
+#ifndef TFT_FRAMEBUFFER
+  #define TFT_FRAMEBUFFER 0
+#endif
+#define TFT_BAND_ROWS    16
+#ifndef TFT_BAND_BUFFERS
+  #define TFT_BAND_BUFFERS 4     // 10 KB each at 320 px
+#endif
+#define TFT_BAND_RECTS   4      // painted rects kept per band
+
+// Blit classic-font text at sizes 1..3 from pre-scaled glyphs built at boot.
+// 0 = let Adafruit_GFX draw every font pixel.
+#ifndef TFT_GLYPH_CACHE
+  #define TFT_GLYPH_CACHE 1
+#endif
+
 // =============================================================================
 // GAME CONSTANTS
 // =============================================================================
@@ -125,7 +147,28 @@
 #define CARD_DEBOUNCE_MS  1200
 #define WAIT_TIMEOUT_MS   20000
 #define HOME_REFRESH_MS   500
+#define ANIM_BUDGET_US    4000   // animation drawing per loop pass
+#define LOOP_IDLE_MS      10     // loop sleep while a button is down or settling
+#ifndef BOOT_BUDGET_MS
+  #define BOOT_BUDGET_MS  800    // reset to last boot stage, warned over
+#endif
+
+// =============================================================================
+// POWER (loop sleeps to its next deadline; button / touch edges wake it)
+// =============================================================================
+#define BL_LEDC_CH        1      // SoundManager has channel 0
+#define BL_PWM_HZ         5000
+#define BL_FULL           255
+#define BL_DIM            40
+#define DIM_AFTER_MS      30000  // no input: backlight to BL_DIM
+#define SLEEP_AFTER_MS    90000  // no input: backlight off, light sleep between deadlines
+#define WAKE_RESPONSE_MS  500    // a wake with no render within this is not timed
 
+// Current model behind PowerStats::avgMa (datasheet figures, not measured)
+#define POWER_MA_RUN      45     // CPU busy at 240 MHz
+#define POWER_MA_WAIT     20     // cores idle in WAITI
+#define POWER_MA_SLEEP    1      // light sleep, peripherals included
+#define POWER_MA_BACKLIGHT 35    // backlight at BL_FULL
 
 // =============================================================================
 // GAME SETTINGS (run-time adjustable)
@@ -3,33 +3,81 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h>
 
+#include "anim_scheduler.h"
 #include "config.h"
+#include "frame_canvas.h"
 #include "game_logic.h"
+#include "ui_widgets.h"
 
 class DisplayUi {
  public:
   bool begin();
   void render(const GameLogic &game, float batteryPercent);
   void renderProgramming(const char *category, uint8_t itemId, const char *detail, bool armWrite, const char *message);
-  void renderLobby(uint8_t registeredCount, uint8_t requiredCount, const bool activePlayers[GAME_MAX_PLAYERS], bool fundingStage, const char *message);
+  void renderLobby(uint8_t registeredCount, uint8_t requiredCount, PlayerMask activePlayers, bool fundingStage, const char *message);
   void renderActionMenu(uint8_t selected);
 
+  const RenderStats &lastRender() const { return panel_.frame; }
+  const RenderStats &totalRender() const { return panel_.total; }
+  const FrameCanvas::TextStats &lastText() const { return tft_.text; }
+  void setGlyphCache(bool on) { tft_.setGlyphCache(on); }
+
+  // Draws due animation frames of the current screen within budgetUs.
+  bool animate(uint32_t nowMs, uint32_t budgetUs);
+  uint32_t nextAnimDueMs() const { return anims_.nextDueMs(); }
+  const AnimScheduler::Stats &animStats() const { return anims_.stats(); }
+
  private:
-  void drawHome(const GameLogic &game);
-  void drawWaitCard(const ActionContext &ctx, bool fullRedraw = true);
+  void drawHome(const GameLogic &game, bool fullRedraw);
+  void drawWaitCard(const ActionContext &ctx, bool fullRedraw);
   void drawPropertyUnowned(const GameLogic &game, const ActionContext &ctx);
   void drawPropertyOwned(const GameLogic &game, const ActionContext &ctx);
   void drawEvent(const ActionContext &ctx);
-  void drawAuction(const ActionContext &ctx);
+  void drawAuction(const ActionContext &ctx, bool fullRedraw);
   void drawDebt(const ActionContext &ctx);
   void drawGo();
   void drawTrain();
   void drawJail();
   void drawWinner(const GameLogic &game, const ActionContext &ctx);
-  void drawStatusBar(UiState state, float batteryPercent);
+  void drawStatusBar(UiState state, float batteryPercent, bool fullRedraw);
+  void beginFrame();
+  void endFrame();
   void clearMain();
 
-  Adafruit_ST7789 tft_{&SPI, PIN_TFT_CS, PIN_TFT_DC, PIN_TFT_RST};
+  static void animWaitBorder(void *self, uint32_t frame);
+  static void animWaitBlink(void *self, uint32_t frame);
+  static void animAuction(void *self, uint32_t frame);
+
+  void homeSlot(uint8_t slot, int16_t &x, int16_t &y, int16_t &w) const;
+  void placeHomeRows(bool compact);
+
+  static constexpr uint8_t HOME_ROWS = GAME_MAX_PLAYERS;
+  static constexpr uint8_t HOME_WIDE_ROWS = 4;  // more players: two columns
+  struct HomeRow {
+    FrameWidget frame;
+    GlyphWidget glyph;
+    TextWidget name;
+    TextWidget balance;
+    TextWidget rank;
+    TextWidget net;
+  };
+
+  CountingST7789 panel_{&SPI, PIN_TFT_CS, PIN_TFT_DC, PIN_TFT_RST};
+  FrameCanvas tft_{panel_, SCREEN_W, SCREEN_H};  // all drawing goes here
+  TextWidget barState_;
+  TextWidget barBattery_;
+  HomeRow homeRows_[HOME_ROWS];
+  bool homeCompact_ = false;
+  TextWidget homeEmpty_;
+  TextWidget homeHint_;
+  TextWidget homeFlash_;
+  TextWidget waitReason_;
+  TextWidget waitNoCancel_;
+  TextWidget auctionSeconds_;
+  TextWidget auctionBid_;
+  TextWidget auctionHint_;
+  AnimScheduler anims_;
+  const GameLogic *game_ = nullptr;
   bool hasLastState_ = false;
   UiState lastState_ = UiState::HOME;
   int lastBattery_ = -1;
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_SPITFT.h>
+
+#include "config.h"
+#include "glyph_atlas.h"
+
+// Adafruit_GFX target that collects each frame in a few row bands. A band
+// of TFT_BAND_ROWS rows takes a buffer from a pool of TFT_BAND_BUFFERS
+// when it is first drawn into, and keeps up to TFT_BAND_RECTS rects that
+// were painted in full this frame. Rects merge only into a rectangle that is
+// still fully painted, so flush() sends nothing the frame did not draw.
+// Pixels stored big-endian (panel order). When the pool is empty, the band
+// used least recently is flushed early.
+//
+// Lone pixels and transparent text outside the painted rects go straight to
+// the panel, as do all calls without a pool (TFT_FRAMEBUFFER=0 or the
+// allocation failed); flush() then does nothing.
+//
+// Text in the classic font at sizes 1..3 is blitted from a GlyphAtlas: a
+// whole printed string is written row by row in one pass (one address
+// window in direct mode) instead of one fillRect per font pixel.
+class FrameCanvas : public Adafruit_GFX {
+ public:
+  static constexpr uint8_t BANDS = (SCREEN_H + TFT_BAND_ROWS - 1) / TFT_BAND_ROWS;
+
+  FrameCanvas(Adafruit_SPITFT &panel, int16_t w, int16_t h) : Adafruit_GFX(w, h), panel_(panel) {}
+
+  bool begin();  // false = direct mode
+  bool buffered() const { return pool_ != nullptr; }
+  uint32_t flush();  // pixels sent
+
+  // Time spent in print()/write(), reset by the caller once per frame
+  struct TextStats {
+    uint32_t micros = 0;
+    uint32_t chars = 0;
+  };
+  TextStats text{};
+  void setGlyphCache(bool on) { useAtlas_ = on && atlas_.ready(); }
+  bool glyphCache() const { return useAtlas_; }
+
+  using Print::write;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+
+ private:
+  struct Rect {
+    int16_t x0, y0, x1, y1;  // inclusive, screen coordinates
+  };
+  struct Band {
+    int8_t slot = -1;  // pool buffer, -1 = none
+    uint8_t count = 0;
+    uint32_t used = 0;  // LRU stamp
+    Rect rects[TFT_BAND_RECTS];
+  };
+
+  static bool contains(const Rect &outer, const Rect &inner) {
+    return inner.x0 >= outer.x0 && inner.x1 <= outer.x1 && inner.y0 >= outer.y0 && inner.y1 <= outer.y1;
+  }
+  uint16_t *row(uint8_t band, int16_t y);
+  bool painted(uint8_t band, const Rect &r) const;
+  void claim(uint8_t band);
+  void paint(uint8_t band, Rect r);
+  uint32_t flushBand(uint8_t band);
+  void fillLoose(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  void writeText(const uint8_t *s, size_t n);
+  void blitRun(int16_t x, int16_t y, const uint8_t *s, uint8_t n, uint8_t size);
+  void blitBands(int16_t x, int16_t y, const uint8_t *s, uint8_t size, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                 bool opaque);
+
+  Adafruit_SPITFT &panel_;
+  uint16_t *pool_ = nullptr;  // TFT_BAND_BUFFERS x (width x TFT_BAND_ROWS)
+  int8_t owner_[TFT_BAND_BUFFERS];  // band holding each buffer, -1 = free
+  Band bands_[BANDS];
+  uint32_t stamp_ = 0;
+  uint32_t sent_ = 0;  // pixels flushed early, added to the next flush()
+  GlyphAtlas atlas_;
+  bool useAtlas_ = false;
+  uint16_t line_[SCREEN_W];  // one blitted text row, direct mode
+};
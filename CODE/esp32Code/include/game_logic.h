@@ -1,7 +1,9 @@
 #pragma once
 
 #include "card_manager.h"
+#include "game_stats.h"
 #include "game_types.h"
+#include "timer_wheel.h"
 
 struct ActionContext {
   WaitReason waitReason = WaitReason::NONE;
@@ -19,7 +21,9 @@ struct ActionContext {
 
 class GameLogic {
  public:
-  void begin();
+  // State deadlines (wait timeouts, the event reveal, auction seconds) are
+  // timers on `timers`; each one fires a TICK into the current state.
+  void begin(TimerWheel &timers);
 
   UiState state() const { return state_; }
   const ActionContext &context() const { return ctx_; }
@@ -31,18 +35,83 @@ class GameLogic {
   void onBtn3();
   void triggerMenuAction(uint8_t action);
   void primePlayer(uint8_t playerId, int32_t balance);
-  void onTick();
+  // Freezes the running deadline while another screen covers the game
+  // (menu, programming mode); the rest of it resumes on release.
+  void hold(bool held);
   uint16_t propertyPrice(uint8_t propertyId) const;
   uint16_t propertyRent(uint8_t propertyId, uint8_t level) const;
 
+  // Standings, maintained on every balance / ownership / price change.
+  // Net worth is balance + basePrice of owned properties; handing a property
+  // over in a debt credits its basePrice, so that is also the liquidation value.
+  int32_t netWorth(uint8_t playerId) const;
+  uint8_t rank(uint8_t playerId) const;  // 1 = leader, 0 = not playing
+  uint8_t rankCount() const { return rankCount_; }
+  const uint8_t *rankOrder() const { return rankOrder_; }  // player indices, leader first
+
+  // Landings, rent and cash history for the post-game report
+  const GameStats &stats() const { return stats_; }
+
   void onPlayerCard(const CardTap &tap, CardManager &cards);
   void onPropertyCard(const CardTap &tap, CardManager &cards);
   void onEventCard(const CardTap &tap, CardManager &cards);
 
+  // Write-behind card sync. Each player / property change bumps that record's
+  // seq and queues it. A tapped card of this game with a newer seq is adopted
+  // (the board was reset); any other mismatch queues the board's record, and
+  // flushCard() writes it to the card just tapped, once the tap is handled.
+  void setGameId(uint8_t gameId) { gameId_ = gameId; }
+  uint8_t gameId() const { return gameId_; }
+  void restorePlayer(const PlayerCardData &card);  // resume from a lobby tap
+  bool flushCard(CardManager &cards);              // true = a record was written
+  uint8_t queuedWrites() const;
+
   bool isDirty() const { return dirty_; }
   void clearDirty() { dirty_ = false; }
 
+  // Called after every handled input (not the table's no-op cells) with the
+  // state before and after and the handler's time.
+  using TransitionHook = void (*)(UiState from, UiState to, GameInput input, uint32_t us);
+  void setTransitionHook(TransitionHook hook) { hook_ = hook; }
+
  private:
+  // One handler per UiState x GameInput (table in game_logic.cpp); arg is
+  // the card or menu id
+  using Handler = void (GameLogic::*)(uint8_t arg);
+  friend struct GameTransitions;
+
+  void dispatch(GameInput input, uint8_t arg = 0);
+  bool handles(GameInput input) const;
+
+  void ignore(uint8_t arg);
+  void goHome(uint8_t arg);
+  void cancelWait(uint8_t arg);
+  void openGo(uint8_t arg);
+  void openJail(uint8_t arg);
+  void menuAction(uint8_t action);
+  void waitBuyer(uint8_t arg);
+  void waitRentPayer(uint8_t arg);
+  void startPropertyAuction(uint8_t arg);
+  void raiseBid(uint8_t arg);
+  void tickTimeout(uint8_t arg);
+  void tickEvent(uint8_t arg);
+  void tickAuction(uint8_t arg);
+  void flashCard(uint8_t playerId);
+  void collectGo(uint8_t playerId);
+  void payJail(uint8_t playerId);
+  void payTrain(uint8_t playerId);
+  void payFine(PlayerState &player, const char *flash);
+  void waitCardPlayer(uint8_t playerId);
+  void buyProperty(uint8_t playerId);
+  void payRent(uint8_t playerId);
+  void eventTarget(uint8_t playerId);
+  void auctionWinner(uint8_t playerId);
+  void showProperty(uint8_t propertyId);
+  void settleDebt(uint8_t propertyId);
+  void showEvent(uint8_t eventId);
+
+  static void onStateTimer(void *self);
+  void armState(uint32_t delayMs);
   void setState(UiState next);
   void touchState();
   void ensurePlayer(uint8_t playerId);
@@ -54,14 +123,40 @@ class GameLogic {
   uint8_t firstOwnedProperty(uint8_t playerId);
   void applyEventToPlayer(const EventCardData &event, uint8_t playerId);
   void startAuction(uint8_t propertyId);
+  void markPlayerDirty(uint8_t playerId);
   void markPropertyDirty(uint8_t propertyId);
+  void syncPlayer(const PlayerCardData &card);
+  void syncProperty(const PropertyCardData &card);
+  void setJailed(PlayerState &player, bool jailed);
+  void adjustBalance(PlayerState &player, int32_t delta);
+  void setBalance(PlayerState &player, int32_t balance);
+  void setOwner(PropertyState &prop, uint8_t ownerId);
+  void setBasePrice(PropertyState &prop, uint16_t price);
+  void setBankrupt(PlayerState &player, bool bankrupt);
+  bool ahead(uint8_t a, uint8_t b) const;
+  void rerank(uint8_t index);
 
   UiState state_ = UiState::HOME;
   ActionContext ctx_{};
   PlayerState players_[GAME_MAX_PLAYERS]{};
   PropertyState properties_[PROPERTY_COUNT]{};
   bool dirty_ = true;
-  uint32_t stateSinceMs_ = 0;
-  uint32_t lastAuctionTickMs_ = 0;
-  bool propertyDirty_[PROPERTY_COUNT]{};
+  TimerWheel *timers_ = nullptr;
+  TimerWheel::Id stateTimer_ = TimerWheel::NONE;
+  uint32_t heldLeftMs_ = 0;  // deadline left when hold() froze it
+  bool held_ = false;
+  PlayerMask dirtyPlayers_ = 0;
+  uint32_t dirtyProperties_ = 0;  // bit = property id - 1
+  uint16_t playerSeq_[GAME_MAX_PLAYERS]{};
+  uint16_t propertySeq_[PROPERTY_COUNT]{};
+  uint8_t gameId_ = 0;
+  CardTap flushTap_{};
+  NfcCardType flushType_ = NfcCardType::UNKNOWN;
+  uint8_t flushId_ = 0;  // record for flushCard(), 0 = none
+  int32_t netWorth_[GAME_MAX_PLAYERS]{};
+  uint8_t rankOrder_[GAME_MAX_PLAYERS]{};
+  uint8_t rank_[GAME_MAX_PLAYERS]{};
+  uint8_t rankCount_ = 0;
+  GameStats stats_{};
+  TransitionHook hook_ = nullptr;
 };
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "game_types.h"
+
+// Fixed-size game statistics, fed by GameLogic. An "action" is one trip from
+// HOME and back (a landing, GO, jail, ...), which is the closest this board has
+// to a turn. Cash is sampled per action into a buffer that halves itself and
+// doubles its stride when full, so the whole game always fits.
+class GameStats {
+ public:
+  static constexpr uint8_t CASH_SAMPLES = 32;
+  static constexpr uint8_t TIME_BUCKETS = 8;  // <2s, <4s, ... >=128s
+
+  void reset();
+  void onLanding(uint8_t playerId, uint8_t propertyId);
+  void onRent(uint8_t fromId, uint8_t toId, uint8_t propertyId, int32_t amount);
+  void onActionStart();
+  void onActionEnd(const PlayerState *players);
+
+  uint8_t topRentProperty() const;  // 0 when no rent was paid
+  uint32_t rentByProperty(uint8_t propertyId) const;
+  uint16_t actions() const { return actions_; }
+  uint32_t avgActionMs() const { return actions_ ? actionTotalMs_ / actions_ : 0; }
+  uint32_t maxActionMs() const { return actionMaxMs_; }
+
+  // Binary report: "MSE" ver(1), LEB128 body, crc16-CCITT (LE). See .cpp.
+  size_t exportTo(Print &out) const;
+
+ private:
+  uint16_t landings_[GAME_MAX_PLAYERS][PROPERTY_COUNT]{};
+  uint32_t rentByProperty_[PROPERTY_COUNT]{};
+  uint32_t rentPaid_[GAME_MAX_PLAYERS]{};
+  uint32_t rentCollected_[GAME_MAX_PLAYERS]{};
+
+  int32_t cash_[GAME_MAX_PLAYERS][CASH_SAMPLES]{};
+  uint8_t cashCount_ = 0;
+  uint16_t cashStride_ = 1;
+  uint16_t cashPhase_ = 0;
+
+  uint32_t actionStartMs_ = 0;
+  uint16_t actions_ = 0;
+  uint32_t actionTotalMs_ = 0;
+  uint32_t actionMaxMs_ = 0;
+  uint16_t actionHist_[TIME_BUCKETS]{};
+};
@@ -15,6 +15,58 @@ enum class UiState : uint8_t {
   JAIL,
   WINNER
 };
+constexpr uint8_t UI_STATE_COUNT = static_cast<uint8_t>(UiState::WINNER) + 1;
+
+// Everything GameLogic reacts to; one column of its transition table each
+enum class GameInput : uint8_t {
+  BTN1,
+  BTN2,
+  BTN3,
+  MENU,
+  TICK,
+  PLAYER_CARD,
+  PROPERTY_CARD,
+  EVENT_CARD
+};
+constexpr uint8_t GAME_INPUT_COUNT = static_cast<uint8_t>(GameInput::EVENT_CARD) + 1;
+
+// Log name and status-bar label, indexed by UiState
+struct UiStateInfo {
+  UiState state;
+  const char *name;
+  const char *label;
+};
+
+constexpr UiStateInfo kUiStateInfo[] = {
+    {UiState::HOME, "HOME", "HOME"},
+    {UiState::WAIT_CARD, "WAIT_CARD", "WAIT"},
+    {UiState::PROPERTY_UNOWNED, "PROPERTY_UNOWNED", "UNOWNED"},
+    {UiState::PROPERTY_OWNED, "PROPERTY_OWNED", "OWNED"},
+    {UiState::EVENT, "EVENT", "EVENT"},
+    {UiState::AUCTION, "AUCTION", "AUCTION"},
+    {UiState::DEBT, "DEBT", "DEBT"},
+    {UiState::GO, "GO", "GO"},
+    {UiState::TRAIN, "TRAIN", "TRAIN"},
+    {UiState::JAIL, "JAIL", "JAIL"},
+    {UiState::WINNER, "WINNER", "WINNER"},
+};
+
+constexpr bool uiStateInfoInOrder() {
+  for (uint8_t i = 0; i < UI_STATE_COUNT; i++) {
+    if (static_cast<uint8_t>(kUiStateInfo[i].state) != i) return false;
+  }
+  return true;
+}
+static_assert(sizeof(kUiStateInfo) / sizeof(kUiStateInfo[0]) == UI_STATE_COUNT, "one kUiStateInfo row per UiState");
+static_assert(uiStateInfoInOrder(), "kUiStateInfo rows must follow UiState order");
+
+inline const char *uiStateName(UiState state) { return kUiStateInfo[static_cast<uint8_t>(state)].name; }
+inline const char *uiStateLabel(UiState state) { return kUiStateInfo[static_cast<uint8_t>(state)].label; }
+
+inline const char *gameInputName(GameInput input) {
+  static const char *const names[GAME_INPUT_COUNT] = {"BTN1", "BTN2", "BTN3", "MENU", "TICK", "PLAYER_CARD", "PROPERTY_CARD", "EVENT_CARD"};
+  return names[static_cast<uint8_t>(input)];
+}
 
 enum class WaitReason : uint8_t {
   NONE,
@@ -63,7 +115,13 @@ struct CardTap {
   NfcCardType type = NfcCardType::UNKNOWN;
   uint8_t uid[7] = {0};
   uint8_t uidLen = 0;
+  uint16_t serial = 0;  // counts reader taps, so a re-presented card is a new tap; 0 = not from the reader
 };
 
-constexpr uint8_t GAME_MAX_PLAYERS = 4;
+constexpr uint8_t GAME_MAX_PLAYERS = 8;
 constexpr uint8_t PROPERTY_COUNT = 28;
+
+// One bit per player id (bit 0 = player 1)
+using PlayerMask = uint8_t;
+static_assert(GAME_MAX_PLAYERS <= 8, "PlayerMask holds one bit per player");
+constexpr PlayerMask playerBit(uint8_t playerId) { return static_cast<PlayerMask>(1u << (playerId - 1)); }
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Arduino.h>
+
+// The classic 6x8 GFX font, pre-scaled to sizes 1..MAX_SIZE. Each glyph is
+// 8*size rows of rowBytes(size) bytes, MSB = leftmost pixel, including the
+// blank spacing column, so a glyph is exactly one character cell.
+class GlyphAtlas {
+ public:
+  static constexpr uint8_t FIRST = 32;
+  static constexpr uint8_t LAST = 126;
+  static constexpr uint8_t MAX_SIZE = 3;
+
+  bool begin();  // rasterise once through GFXcanvas1; ~10 KB heap
+  bool ready() const { return bits_[0] != nullptr; }
+  bool has(uint8_t size, uint8_t c) const {
+    return size >= 1 && size <= MAX_SIZE && c >= FIRST && c <= LAST && bits_[size - 1] != nullptr;
+  }
+  const uint8_t *glyph(uint8_t size, uint8_t c) const {
+    return bits_[size - 1] + static_cast<uint16_t>(c - FIRST) * glyphBytes(size);
+  }
+
+  static uint8_t rowBytes(uint8_t size) { return (6 * size + 7) / 8; }
+  static uint16_t glyphBytes(uint8_t size) { return rowBytes(size) * 8 * size; }
+
+ private:
+  uint8_t *bits_[MAX_SIZE] = {};
+};
@@ -5,17 +5,27 @@
 
 #include "config.h"
 #include "game_types.h"
+#include "timer_wheel.h"
 
 class NfcManager {
  public:
   bool begin();
- bool poll(CardTap &tap);
+  // Poll pacing and same-card debounce run on `timers`, from the loop core
+  void attach(TimerWheel &timers) { timers_ = &timers; }
+  bool poll(CardTap &tap);
+  bool ready() const { return ready_; }
   Adafruit_PN532 &driver() { return nfc_; }
 
  private:
   Adafruit_PN532 nfc_{static_cast<uint8_t>(PIN_NFC_IRQ), static_cast<uint8_t>(PIN_NFC_RST), &Wire};
   uint8_t lastUid_[7] = {0};
   uint8_t lastUidLen_ = 0;
-  uint32_t lastSeenMs_ = 0;
-  uint32_t lastPollMs_ = 0;
+  static void onPollDue(void *self);
+  static void onDebounceEnd(void *self);
+
+  TimerWheel *timers_ = nullptr;
+  TimerWheel::Id debounceTimer_ = TimerWheel::NONE;
+  bool pollDue_ = true;
+  uint16_t taps_ = 0;
+  volatile bool ready_ = false;  // set last: begin() runs on the boot task
 };
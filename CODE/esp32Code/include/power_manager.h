@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+
+struct PowerStats {
+  uint32_t runMs = 0;    // loop busy
+  uint32_t waitMs = 0;   // blocked until a deadline or an edge
+  uint32_t sleepMs = 0;  // in light sleep
+  uint32_t sleeps = 0;
+  uint32_t wakes = 0;      // edge wakes timed to a render
+  uint32_t wakeUs = 0;     // last one: edge to the end of its render
+  uint32_t maxWakeUs = 0;
+  float avgMa = 0.0f;      // estimate from the POWER_MA_* model
+};
+
+// Loop pacing and screen power. idle() blocks the loop task until the
+// deadline it is given; button and touch edges wake it early. With no input
+// for DIM_AFTER_MS the backlight dims; after SLEEP_AFTER_MS it goes off and
+// the chip light-sleeps to the deadline instead, woken by the same pins.
+// Every edge wake that leads to a render is timed and handed to the hook.
+// An edge that lights a dark screen is flagged so the loop can drop the
+// press: nobody saw what it would have hit.
+class PowerManager {
+ public:
+  using Hook = void (*)(const PowerStats &stats);
+
+  void begin();       // setup(): the loop task is the one woken
+  void activity();    // input no pin saw (a card tap)
+  void idle(uint32_t waitMs, bool mayLightSleep);
+  void rendered();    // a render went out: times a pending wake
+  bool takeDarkWake();  // an edge found the screen off since the last call
+  bool screenOn() const { return level_ != 0; }
+  void setHook(Hook hook) { hook_ = hook; }
+  PowerStats stats();
+
+ private:
+  void setBacklight(uint8_t level);
+  void account(uint32_t nowMs);
+  void onWake(uint32_t edgeUs);
+  void lightSleep(uint32_t waitMs);
+
+  PowerStats stats_;
+  Hook hook_ = nullptr;
+  uint8_t level_ = 0;
+  uint32_t levelMarkMs_ = 0;  // millis() of the last level change
+  uint64_t levelMs_ = 0;      // sum of level x ms, for the current estimate
+  uint32_t lastIdleMs_ = 0;   // last return from idle()
+  uint32_t activityMs_ = 0;
+  uint32_t wakeUs_ = 0;       // edge being answered, 0 = none
+  bool darkWake_ = false;
+};
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <TimerWheel.h>  // CODE/lib, shared with UI/v2
+
+// Deadlines for the whole firmware: state timeouts, the auction countdown,
+// message expiry, NFC poll pacing and debounce.
+using TimerWheel = BasicTimerWheel<16>;
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_ST7789.h>
+
+// Pixels and bytes pushed to the panel. Every SPITFT primitive opens an
+// address window and streams w*h pixels into it, so counting windows is exact.
+struct RenderStats {
+  uint32_t windows = 0;
+  uint32_t pixels = 0;
+  uint32_t bytes = 0;  // RGB565 data + CASET/RASET/RAMWR per window
+
+  void add(uint16_t w, uint16_t h) {
+    const uint32_t n = static_cast<uint32_t>(w) * h;
+    windows++;
+    pixels += n;
+    bytes += n * 2 + 11;
+  }
+};
+
+class CountingST7789 : public Adafruit_ST7789 {
+ public:
+  using Adafruit_ST7789::Adafruit_ST7789;
+
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override {
+    frame.add(w, h);
+    total.add(w, h);
+    Adafruit_ST7789::setAddrWindow(x, y, w, h);
+  }
+
+  RenderStats frame{};  // cleared by DisplayUi at the start of each render
+  RenderStats total{};
+};
+
+// Retained widgets remember what they last put on screen and repaint only
+// when that changes. invalidate() after anything else paints over them.
+
+// Built-in 6x8 font, drawn opaque so no separate erase pass is needed. Only
+// the characters from the first difference onwards are repainted, plus the
+// tail of the old text when the new one is shorter.
+class TextWidget {
+ public:
+  static constexpr uint8_t MAX_LEN = 31;
+
+  void place(int16_t x, int16_t y, uint8_t size);
+  bool draw(Adafruit_GFX &gfx, const char *text, uint16_t color, uint16_t bg);
+  bool drawInt(Adafruit_GFX &gfx, const char *prefix, int32_t value, uint16_t color, uint16_t bg);
+  void clear(Adafruit_GFX &gfx, uint16_t bg);
+  void invalidate() { valid_ = false; }
+
+ private:
+  int16_t x_ = 0;
+  int16_t y_ = 0;
+  uint8_t size_ = 1;
+  uint16_t color_ = 0;
+  uint8_t len_ = 0;
+  char text_[MAX_LEN + 1] = {0};
+  bool valid_ = false;
+};
+
+// Rounded outline; repainted (old outline erased) when geometry or colour change.
+class FrameWidget {
+ public:
+  bool draw(Adafruit_GFX &gfx, int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color, uint16_t bg);
+  void clear(Adafruit_GFX &gfx, uint16_t bg);
+  void invalidate() { valid_ = false; }
+
+ private:
+  int16_t x_ = 0, y_ = 0, w_ = 0, h_ = 0, r_ = 0;
+  uint16_t color_ = 0;
+  bool valid_ = false;
+};
+
+// Fixed-size icon cell keyed by (id, colour); painter draws the icon at (x, y).
+class GlyphWidget {
+ public:
+  using Painter = void (*)(Adafruit_GFX &gfx, int16_t x, int16_t y, uint8_t id, uint16_t color);
+
+  void place(int16_t x, int16_t y, uint8_t w, uint8_t h);
+  bool draw(Adafruit_GFX &gfx, Painter paint, uint8_t id, uint16_t color, uint16_t bg);
+  void clear(Adafruit_GFX &gfx, uint16_t bg);
+  void invalidate() { valid_ = false; }
+
+ private:
+  int16_t x_ = 0, y_ = 0;
+  uint8_t w_ = 0, h_ = 0;
+  uint8_t id_ = 0;
+  uint16_t color_ = 0;
+  bool valid_ = false;
+};
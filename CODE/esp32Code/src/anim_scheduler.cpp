@@ -0,0 +1,79 @@
+#include "anim_scheduler.h"
+
+int8_t AnimScheduler::add(uint16_t periodMs, DrawFn draw, void *ctx) {
+  if (!draw || periodMs == 0) return -1;
+  for (uint8_t i = 0; i < MAX_REGIONS; i++) {
+    Region &r = regions_[i];
+    if (r.draw) continue;
+    r.draw = draw;
+    r.ctx = ctx;
+    r.periodMs = periodMs;
+    r.dueMs = millis() + periodMs;
+    r.frame = 0;
+    count_++;
+    return static_cast<int8_t>(i);
+  }
+  return -1;
+}
+
+void AnimScheduler::remove(int8_t id) {
+  if (id < 0 || id >= MAX_REGIONS || !regions_[id].draw) return;
+  regions_[id] = Region{};
+  count_--;
+}
+
+void AnimScheduler::clear() {
+  for (Region &r : regions_) r = Region{};
+  count_ = 0;
+}
+
+bool AnimScheduler::run(uint32_t nowMs, uint32_t budgetUs) {
+  if (count_ == 0) return false;
+  const uint32_t t0 = micros();
+  bool drew = false;
+
+  for (;;) {
+    // Most overdue region first
+    Region *next = nullptr;
+    for (Region &r : regions_) {
+      if (!r.draw || static_cast<int32_t>(nowMs - r.dueMs) < 0) continue;
+      if (!next || static_cast<int32_t>(r.dueMs - next->dueMs) < 0) next = &r;
+    }
+    if (!next) break;
+
+    if (drew && micros() - t0 >= budgetUs) {
+      for (const Region &r : regions_) {
+        if (r.draw && static_cast<int32_t>(nowMs - r.dueMs) >= 0) stats_.deferred++;
+      }
+      break;
+    }
+
+    // Coalesce: one draw for all elapsed periods
+    const uint32_t late = (nowMs - next->dueMs) / next->periodMs;
+    stats_.missed += late;
+    next->frame += late + 1;
+    next->dueMs += (late + 1) * next->periodMs;
+    next->draw(next->ctx, next->frame);
+    stats_.draws++;
+    drew = true;
+  }
+
+  if (drew) {
+    const uint32_t us = micros() - t0;
+    stats_.frames++;
+    stats_.lastFrameUs = us;
+    if (us > stats_.maxFrameUs) stats_.maxFrameUs = us;
+  }
+  return drew;
+}
+
+uint32_t AnimScheduler::nextDueMs() const {
+  uint32_t best = UINT32_MAX;
+  bool any = false;
+  for (const Region &r : regions_) {
+    if (!r.draw) continue;
+    if (!any || static_cast<int32_t>(r.dueMs - best) < 0) best = r.dueMs;
+    any = true;
+  }
+  return best;
+}
@@ -0,0 +1,78 @@
+#include "boot_trace.h"
+
+#include "config.h"
+
+void BootTrace::mark(const char *stage) {
+  portENTER_CRITICAL(&lock_);
+  if (count_ < MAX_STAGES) {
+    Stage &s = stages_[count_++];
+    s.name = stage;
+    s.us = micros();
+    s.core = static_cast<uint8_t>(xPortGetCoreID());
+  }
+  portEXIT_CRITICAL(&lock_);
+}
+
+void BootTrace::taskMain(void *arg) {
+  Task *task = static_cast<Task *>(arg);
+  task->fn(task->ctx);
+  task->owner->finish(*task);
+  vTaskDelete(nullptr);
+}
+
+void BootTrace::finish(const Task &task) {
+  mark(task.name);
+  portENTER_CRITICAL(&lock_);
+  pending_--;
+  portEXIT_CRITICAL(&lock_);
+}
+
+void BootTrace::spawn(const char *name, TaskFn fn, void *ctx) {
+  if (taskCount_ < MAX_TASKS) {
+    Task &task = tasks_[taskCount_++];
+    task.owner = this;
+    task.name = name;
+    task.fn = fn;
+    task.ctx = ctx;
+    portENTER_CRITICAL(&lock_);
+    pending_++;
+    portEXIT_CRITICAL(&lock_);
+    // Core 0: the Arduino loop (display, buttons) runs on core 1
+    if (xTaskCreatePinnedToCore(taskMain, name, 4096, &task, 1, nullptr, 0) == pdPASS) return;
+    portENTER_CRITICAL(&lock_);
+    pending_--;
+    portEXIT_CRITICAL(&lock_);
+  }
+  // No slot or no task: bring it up here, still traced
+  fn(ctx);
+  mark(name);
+}
+
+bool BootTrace::report(LineFn emit) {
+  if (reported_ || !done()) return false;
+  reported_ = true;
+
+  char line[64];
+  uint32_t prevMs = 0;
+  uint32_t totalMs = 0;
+  emit("[BOOT] timeline (ms since reset, +delta, core)");
+  for (uint8_t i = 0; i < count_; i++) {
+    // Marks are in time order across both cores
+    const Stage &s = stages_[i];
+    const uint32_t ms = s.us / 1000;
+    snprintf(line, sizeof(line), "[BOOT] %6lu  +%5lu  c%u  %s", static_cast<unsigned long>(ms),
+             static_cast<unsigned long>(ms - prevMs), s.core, s.name);
+    emit(line);
+    prevMs = ms;
+    if (ms > totalMs) totalMs = ms;
+  }
+  if (totalMs > BOOT_BUDGET_MS) {
+    snprintf(line, sizeof(line), "[BOOT] over budget: %lu ms > %u ms", static_cast<unsigned long>(totalMs),
+             static_cast<unsigned>(BOOT_BUDGET_MS));
+  } else {
+    snprintf(line, sizeof(line), "[BOOT] %lu ms (budget %u ms)", static_cast<unsigned long>(totalMs),
+             static_cast<unsigned>(BOOT_BUDGET_MS));
+  }
+  emit(line);
+  return true;
+}
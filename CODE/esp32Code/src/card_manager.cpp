@@ -8,35 +8,70 @@ constexpr uint8_t EVENT_BLOCK = 12;
 constexpr uint8_t MAGIC0 = 'M';
 constexpr uint8_t MAGIC1 = 'B';
 constexpr uint8_t MAGIC2 = '2';
-constexpr uint8_t VERSION = 1;
+constexpr uint8_t VERSION = 2;  // 2: seq + game id
 }  // namespace
 
+void CardManager::forget() {
+  authSector_ = NO_SECTOR;
+  cachedBlock_ = 0;
+}
+
+// The PN532 keeps a sector's authentication until the next target selection,
+// which only a new tap does.
 bool CardManager::auth(const CardTap &tap, uint8_t block) {
-  return nfc_.mifareclassic_AuthenticateBlock(const_cast<uint8_t *>(tap.uid), tap.uidLen, block, 0, const_cast<uint8_t *>(KEY_A));
+  if (tap.serial == 0 || tap.serial != tapSerial_) {
+    forget();
+    tapSerial_ = tap.serial;
+  }
+  const uint8_t sector = block / 4;
+  if (tap.serial != 0 && sector == authSector_) return true;
+  if (!nfc_.mifareclassic_AuthenticateBlock(const_cast<uint8_t *>(tap.uid), tap.uidLen, block, 0, const_cast<uint8_t *>(KEY_A))) {
+    forget();
+    return false;
+  }
+  authSector_ = sector;
+  return true;
 }
 
-bool CardManager::readBlock(uint8_t block, uint8_t out[16]) {
-  return nfc_.mifareclassic_ReadDataBlock(block, out);
+bool CardManager::readBlock(const CardTap &tap, uint8_t block, uint8_t out[16]) {
+  if (!auth(tap, block)) return false;
+  if (tap.serial != 0 && block == cachedBlock_) {
+    memcpy(out, cache_, sizeof(cache_));
+    return true;
+  }
+  if (!nfc_.mifareclassic_ReadDataBlock(block, out)) {
+    forget();
+    return false;
+  }
+  memcpy(cache_, out, sizeof(cache_));
+  cachedBlock_ = block;
+  return true;
 }
 
 bool CardManager::writeBlock(uint8_t block, const uint8_t in[16]) {
-  return nfc_.mifareclassic_WriteDataBlock(block, const_cast<uint8_t *>(in));
+  if (!nfc_.mifareclassic_WriteDataBlock(block, const_cast<uint8_t *>(in))) {
+    forget();
+    return false;
+  }
+  memcpy(cache_, in, sizeof(cache_));
+  cachedBlock_ = block;
+  return true;
 }
 
 NfcCardType CardManager::detectType(const CardTap &tap) {
   uint8_t block[16] = {0};
 
-  if (auth(tap, PLAYER_BLOCK) && readBlock(PLAYER_BLOCK, block)) {
+  if (readBlock(tap, PLAYER_BLOCK, block)) {
     if (block[0] == MAGIC0 && block[1] == MAGIC1 && block[2] == MAGIC2 && block[4] == static_cast<uint8_t>(NfcCardType::PLAYER)) {
       return NfcCardType::PLAYER;
     }
   }
-  if (auth(tap, PROPERTY_BLOCK) && readBlock(PROPERTY_BLOCK, block)) {
+  if (readBlock(tap, PROPERTY_BLOCK, block)) {
     if (block[0] == MAGIC0 && block[1] == MAGIC1 && block[2] == MAGIC2 && block[4] == static_cast<uint8_t>(NfcCardType::PROPERTY)) {
       return NfcCardType::PROPERTY;
     }
   }
-  if (auth(tap, EVENT_BLOCK) && readBlock(EVENT_BLOCK, block)) {
+  if (readBlock(tap, EVENT_BLOCK, block)) {
     if (block[0] == MAGIC0 && block[1] == MAGIC1 && block[2] == MAGIC2 && block[4] == static_cast<uint8_t>(NfcCardType::EVENT)) {
       return NfcCardType::EVENT;
     }
@@ -46,13 +81,15 @@ NfcCardType CardManager::detectType(const CardTap &tap) {
 
 bool CardManager::readPlayer(const CardTap &tap, PlayerCardData &out) {
   uint8_t b[16] = {0};
-  if (!auth(tap, PLAYER_BLOCK) || !readBlock(PLAYER_BLOCK, b)) return false;
+  if (!readBlock(tap, PLAYER_BLOCK, b)) return false;
   if (b[0] != MAGIC0 || b[1] != MAGIC1 || b[2] != MAGIC2 || b[4] != static_cast<uint8_t>(NfcCardType::PLAYER)) return false;
 
   out.playerId = b[5];
   out.balance = static_cast<int32_t>(b[6]) | (static_cast<int32_t>(b[7]) << 8) | (static_cast<int32_t>(b[8]) << 16) | (static_cast<int32_t>(b[9]) << 24);
   out.jailed = b[10];
   out.bankrupt = b[11];
+  out.seq = static_cast<uint16_t>(b[12]) | (static_cast<uint16_t>(b[13]) << 8);
+  out.gameId = b[14];
   return true;
 }
 
@@ -70,19 +107,24 @@ bool CardManager::writePlayer(const CardTap &tap, const PlayerCardData &data) {
   b[9] = static_cast<uint8_t>((data.balance >> 24) & 0xFF);
   b[10] = data.jailed;
   b[11] = data.bankrupt;
+  b[12] = static_cast<uint8_t>(data.seq & 0xFF);
+  b[13] = static_cast<uint8_t>((data.seq >> 8) & 0xFF);
+  b[14] = data.gameId;
   if (!auth(tap, PLAYER_BLOCK)) return false;
   return writeBlock(PLAYER_BLOCK, b);
 }
 
 bool CardManager::readProperty(const CardTap &tap, PropertyCardData &out) {
   uint8_t b[16] = {0};
-  if (!auth(tap, PROPERTY_BLOCK) || !readBlock(PROPERTY_BLOCK, b)) return false;
+  if (!readBlock(tap, PROPERTY_BLOCK, b)) return false;
   if (b[0] != MAGIC0 || b[1] != MAGIC1 || b[2] != MAGIC2 || b[4] != static_cast<uint8_t>(NfcCardType::PROPERTY)) return false;
 
   out.propertyId = b[5];
   out.ownerId = b[6];
   out.level = b[7] == 0 ? 1 : b[7];
   out.basePrice = static_cast<uint16_t>(b[8]) | (static_cast<uint16_t>(b[9]) << 8);
+  out.seq = static_cast<uint16_t>(b[10]) | (static_cast<uint16_t>(b[11]) << 8);
+  out.gameId = b[12];
   return true;
 }
 
@@ -98,13 +140,16 @@ bool CardManager::writeProperty(const CardTap &tap, const PropertyCardData &data
   b[7] = data.level;
   b[8] = static_cast<uint8_t>(data.basePrice & 0xFF);
   b[9] = static_cast<uint8_t>((data.basePrice >> 8) & 0xFF);
+  b[10] = static_cast<uint8_t>(data.seq & 0xFF);
+  b[11] = static_cast<uint8_t>((data.seq >> 8) & 0xFF);
+  b[12] = data.gameId;
   if (!auth(tap, PROPERTY_BLOCK)) return false;
   return writeBlock(PROPERTY_BLOCK, b);
 }
 
 bool CardManager::readEvent(const CardTap &tap, EventCardData &out) {
   uint8_t b[16] = {0};
-  if (!auth(tap, EVENT_BLOCK) || !readBlock(EVENT_BLOCK, b)) return false;
+  if (!readBlock(tap, EVENT_BLOCK, b)) return false;
   if (b[0] != MAGIC0 || b[1] != MAGIC1 || b[2] != MAGIC2 || b[4] != static_cast<uint8_t>(NfcCardType::EVENT)) return false;
 
   out.eventId = b[5];
@@ -1,6 +1,7 @@
 #include "display_ui.h"
 
 #include <SPI.h>
+#include <stdio.h>
 
 namespace {
 constexpr uint16_t BG = 0x08A3;        // deep navy
@@ -12,44 +13,17 @@ constexpr uint16_t WARN = 0xFD20;      // orange
 constexpr uint16_t BAD = 0xF800;       // red
 
 uint16_t playerColor(uint8_t id) {
-  switch ((id - 1) % 4) {
-    case 0:
-      return 0xF800;  // red
-    case 1:
-      return 0x07FF;  // cyan
-    case 2:
-      return 0xFFE0;  // yellow
-    default:
-      return 0xFB92;  // pink
-  }
-}
-
-const char *stateName(UiState state) {
-  switch (state) {
-    case UiState::HOME:
-      return "HOME";
-    case UiState::WAIT_CARD:
-      return "WAIT";
-    case UiState::PROPERTY_UNOWNED:
-      return "UNOWNED";
-    case UiState::PROPERTY_OWNED:
-      return "OWNED";
-    case UiState::EVENT:
-      return "EVENT";
-    case UiState::AUCTION:
-      return "AUCTION";
-    case UiState::DEBT:
-      return "DEBT";
-    case UiState::GO:
-      return "GO";
-    case UiState::TRAIN:
-      return "TRAIN";
-    case UiState::JAIL:
-      return "JAIL";
-    case UiState::WINNER:
-      return "WINNER";
-  }
-  return "?";
+  static const uint16_t colors[] = {
+      0xF800,  // red
+      0x07FF,  // cyan
+      0xFFE0,  // yellow
+      0xFB92,  // pink
+      0x87E0,  // lime
+      0xFC60,  // orange
+      0xB81F,  // violet
+      0xC618,  // silver
+  };
+  return colors[(id - 1) % 8];
 }
 
 const char *iconByPlayerId(uint8_t id) {
@@ -58,8 +32,8 @@ const char *iconByPlayerId(uint8_t id) {
   return icons[id - 1];
 }
 
-void drawTokenGlyph(Adafruit_ST7789 &tft, int16_t x, int16_t y, uint8_t playerId, uint16_t color) {
-  const uint8_t kind = (playerId - 1) % 4;
+void drawTokenGlyph(Adafruit_GFX &tft, int16_t x, int16_t y, uint8_t playerId, uint16_t color) {
+  const uint8_t kind = (playerId - 1) % 8;
   if (kind == 0) {
     // car
     tft.drawRect(x + 1, y + 3, 10, 5, color);
@@ -85,10 +59,67 @@ void drawTokenGlyph(Adafruit_ST7789 &tft, int16_t x, int16_t y, uint8_t playerId
     tft.drawPixel(x + 10, y + 4, color);
     return;
   }
-  // hat
+  if (kind == 3) {
+    // hat
+    tft.drawFastHLine(x + 1, y + 9, 10, color);
+    tft.drawFastHLine(x + 3, y + 7, 6, color);
+    tft.drawFastHLine(x + 4, y + 5, 4, color);
+    return;
+  }
+  if (kind == 4) {
+    // boot
+    tft.drawRect(x + 3, y + 1, 4, 7, color);
+    tft.drawRect(x + 3, y + 7, 8, 3, color);
+    return;
+  }
+  if (kind == 5) {
+    // dog
+    tft.drawRect(x + 2, y + 5, 7, 3, color);
+    tft.fillRect(x + 8, y + 3, 3, 3, color);
+    tft.drawFastVLine(x + 3, y + 8, 3, color);
+    tft.drawFastVLine(x + 8, y + 8, 3, color);
+    tft.drawLine(x + 2, y + 5, x + 1, y + 3, color);
+    return;
+  }
+  if (kind == 6) {
+    // cat
+    tft.drawCircle(x + 6, y + 7, 3, color);
+    tft.drawLine(x + 3, y + 5, x + 3, y + 2, color);
+    tft.drawLine(x + 3, y + 2, x + 5, y + 4, color);
+    tft.drawLine(x + 9, y + 5, x + 9, y + 2, color);
+    tft.drawLine(x + 9, y + 2, x + 7, y + 4, color);
+    return;
+  }
+  // iron
   tft.drawFastHLine(x + 1, y + 9, 10, color);
-  tft.drawFastHLine(x + 3, y + 7, 6, color);
-  tft.drawFastHLine(x + 4, y + 5, 4, color);
+  tft.drawLine(x + 1, y + 9, x + 5, y + 4, color);
+  tft.drawFastHLine(x + 5, y + 4, 6, color);
+  tft.drawFastVLine(x + 10, y + 4, 5, color);
+  tft.drawFastHLine(x + 6, y + 2, 3, color);
+}
+
+constexpr int16_t kWaitX = 116;
+constexpr int16_t kWaitY = 52;
+constexpr int16_t kWaitW = 86;
+constexpr int16_t kWaitH = 136;
+constexpr int16_t kWaitStep = 8;
+constexpr int16_t kWaitDash = 4;
+
+// Marching dashes: even and odd dash slots never overlap, so a phase change
+// only paints the old slots in BG and the new ones in FG.
+void drawWaitDashes(Adafruit_GFX &gfx, uint8_t phase, uint16_t color) {
+  for (int16_t i = 0; i < kWaitW; i += kWaitStep) {
+    if (((i / kWaitStep) + phase) % 2 == 0) {
+      gfx.drawFastHLine(kWaitX + i, kWaitY, kWaitDash, color);
+      gfx.drawFastHLine(kWaitX + i, kWaitY + kWaitH, kWaitDash, color);
+    }
+  }
+  for (int16_t i = 0; i < kWaitH; i += kWaitStep) {
+    if (((i / kWaitStep) + phase) % 2 == 0) {
+      gfx.drawFastVLine(kWaitX, kWaitY + i, kWaitDash, color);
+      gfx.drawFastVLine(kWaitX + kWaitW, kWaitY + i, kWaitDash, color);
+    }
+  }
 }
 }  // namespace
 
@@ -104,150 +135,247 @@ bool DisplayUi::begin() {
 
   SPI.begin(PIN_TFT_SCLK, PIN_TFT_MISO, PIN_TFT_MOSI, PIN_TFT_CS);
 
-  tft_.init(240, 320);
+  panel_.init(240, 320);
 #if TFT_ROTATE_180
-  tft_.setRotation(1);
+  panel_.setRotation(1);
 #else
-  tft_.setRotation(3);
+  panel_.setRotation(3);
 #endif
-  tft_.invertDisplay(false);
-  tft_.setSPISpeed(40000000);
+  panel_.invertDisplay(false);
+  panel_.setSPISpeed(40000000);
 
-  tft_.fillScreen(ST77XX_RED);
+#if DISPLAY_SELFTEST
+  panel_.fillScreen(ST77XX_RED);
   delay(120);
-  tft_.fillScreen(ST77XX_GREEN);
+  panel_.fillScreen(ST77XX_GREEN);
   delay(120);
-  tft_.fillScreen(ST77XX_BLUE);
+  panel_.fillScreen(ST77XX_BLUE);
   delay(120);
-  tft_.fillScreen(BG);
+#endif
+
+  if (tft_.begin()) {
+    DBG("%u band buffers of %u rows", TFT_BAND_BUFFERS, TFT_BAND_ROWS);
+  } else {
+    DBG_PRINT("no framebuffer, drawing to panel");
+  }
   tft_.setTextWrap(false);
+#if DEBUG
+  // The most redrawn strings, through GFX and through the glyph atlas
+  uint32_t textUs[2] = {0, 0};
+  for (uint8_t cached = 0; cached < 2; cached++) {
+    tft_.setGlyphCache(cached);
+    tft_.text = {};
+    for (uint8_t i = 0; i < 8; i++) {
+      tft_.setTextColor(FG, BG);
+      tft_.setTextSize(2);
+      tft_.setCursor(96, 30);
+      tft_.print("TAP CARD");
+      tft_.setTextSize(3);
+      tft_.setCursor(10, 118);
+      tft_.print(1500);
+    }
+    textUs[cached] = tft_.text.micros;
+  }
+  tft_.setGlyphCache(TFT_GLYPH_CACHE);
+  DBG("text x8: gfx %lu us, atlas %lu us", static_cast<unsigned long>(textUs[0]),
+      static_cast<unsigned long>(textUs[1]));
+#endif
+  tft_.fillScreen(BG);
+  tft_.flush();
+
+  barState_.place(44, 6, 1);
+  barBattery_.place(274, 6, 1);
+  placeHomeRows(false);
+  homeEmpty_.place(12, 104, 2);
+  homeHint_.place(8, 218, 1);
+  homeFlash_.place(8, 232, 1);
+  waitReason_.place(8, 212, 1);
+  waitNoCancel_.place(8, 228, 1);
+  auctionSeconds_.place(180, 64, 2);
+  auctionBid_.place(10, 114, 3);
+  auctionHint_.place(8, 212, 1);
   return true;
 }
 
+void DisplayUi::beginFrame() {
+  panel_.frame = RenderStats{};
+  tft_.text = {};
+}
+
+void DisplayUi::endFrame() {
+  tft_.flush();
+}
+
 void DisplayUi::clearMain() {
   tft_.fillRect(0, 0, SCREEN_W, SCREEN_H, BG);
+  // Whatever render() left on screen is gone; repaint it fully next time.
+  hasLastState_ = false;
+  anims_.clear();
 }
 
-void DisplayUi::drawStatusBar(UiState state, float batteryPercent) {
-  tft_.fillRect(0, 0, SCREEN_W, 22, ACCENT);
-  tft_.drawFastHLine(0, 22, SCREEN_W, 0x4B3B);
-  tft_.setTextColor(FG);
-  tft_.setTextSize(1);
-  tft_.setCursor(6, 6);
-  tft_.print("bank");
-  tft_.setCursor(44, 6);
-  tft_.print(stateName(state));
-  tft_.setCursor(274, 6);
-  tft_.print((int)batteryPercent);
-  tft_.print('%');
+bool DisplayUi::animate(uint32_t nowMs, uint32_t budgetUs) {
+  if (anims_.empty()) return false;
+  beginFrame();
+  if (!anims_.run(nowMs, budgetUs)) return false;
+  endFrame();
+  return true;
 }
 
-void DisplayUi::drawHome(const GameLogic &game) {
-  tft_.fillRect(0, 24, SCREEN_W, SCREEN_H - 24, BG);
-  const PlayerState *players = game.players();
-
-  tft_.drawRect(4, 26, SCREEN_W - 8, 188, 0x4B3B);
-  tft_.setTextSize(2);
-  int y = 34;
-  bool any = false;
-  for (uint8_t i = 0; i < GAME_MAX_PLAYERS; i++) {
-    if (!players[i].active || players[i].bankrupt) continue;
-    any = true;
-    const uint16_t c = playerColor(players[i].id);
-    tft_.drawRoundRect(10, y - 2, SCREEN_W - 20, 36, 6, c);
-    tft_.setTextColor(c);
-    drawTokenGlyph(tft_, 18, y + 8, players[i].id, c);
-    tft_.setCursor(38, y + 2);
-    tft_.print("Player ");
-    tft_.print(players[i].id);
-    tft_.setTextColor(MONEY);
-    tft_.setCursor(38, y + 18);
-    tft_.print(players[i].balance);
-    y += 42;
-    if (y > 170) break;
-  }
-
-  if (!any) {
+void DisplayUi::drawStatusBar(UiState state, float batteryPercent, bool fullRedraw) {
+  if (fullRedraw) {
+    tft_.fillRect(0, 0, SCREEN_W, 22, ACCENT);
+    tft_.drawFastHLine(0, 22, SCREEN_W, 0x4B3B);
     tft_.setTextColor(FG);
-    tft_.setTextSize(2);
-    tft_.setCursor(12, 104);
-    tft_.print("tap player card");
+    tft_.setTextSize(1);
+    tft_.setCursor(6, 6);
+    tft_.print("bank");
+    barState_.invalidate();
+    barBattery_.invalidate();
   }
+  barState_.draw(tft_, uiStateLabel(state), FG, ACCENT);
+  char pct[8];
+  snprintf(pct, sizeof(pct), "%d%%", static_cast<int>(batteryPercent));
+  barBattery_.draw(tft_, pct, FG, ACCENT);
+}
 
-  tft_.setTextColor(0xBDF7);
-  tft_.setTextSize(1);
-  tft_.setCursor(8, 218);
-  tft_.print("X:back   M:menu   Y:select");
+// Up to HOME_WIDE_ROWS players get full-width rows; more switch the home
+// screen to a two-column grid, ranks running down the left column first.
+void DisplayUi::homeSlot(uint8_t slot, int16_t &x, int16_t &y, int16_t &w) const {
+  if (!homeCompact_) {
+    x = 10;
+    y = 34 + 42 * slot;
+    w = SCREEN_W - 20;
+    return;
+  }
+  x = 10 + 152 * (slot / HOME_WIDE_ROWS);
+  y = 34 + 42 * (slot % HOME_WIDE_ROWS);
+  w = 148;
+}
 
-  if (game.context().flash[0] != '\0') {
-    tft_.setTextSize(1);
-    tft_.setTextColor(WARN);
-    tft_.setCursor(8, 232);
-    tft_.print(game.context().flash);
+void DisplayUi::placeHomeRows(bool compact) {
+  homeCompact_ = compact;
+  for (uint8_t r = 0; r < HOME_ROWS; r++) {
+    int16_t x, y, w;
+    homeSlot(r, x, y, w);
+    HomeRow &row = homeRows_[r];
+    row.glyph.place(x + 8, y + 8, 12, 12);
+    row.name.place(x + 28, y + 2, 2);
+    row.balance.place(x + 28, y + 18, 2);
+    if (compact) {
+      row.rank.place(x + w - 28, y + 2, 2);
+      row.net.place(x + 58, y + 6, 1);
+    } else {
+      row.rank.place(x + w - 52, y + 2, 2);
+      row.net.place(x + w - 100, y + 22, 1);
+    }
   }
 }
 
-void DisplayUi::drawWaitCard(const ActionContext &ctx, bool fullRedraw) {
+void DisplayUi::drawHome(const GameLogic &game, bool fullRedraw) {
+  const PlayerState *players = game.players();
+  uint8_t alive = 0;
+  for (uint8_t i = 0; i < GAME_MAX_PLAYERS; i++) {
+    if (players[i].active && !players[i].bankrupt) alive++;
+  }
+  const bool compact = alive > HOME_WIDE_ROWS;
+  if (compact != homeCompact_) {
+    placeHomeRows(compact);
+    fullRedraw = true;
+  }
+
   if (fullRedraw) {
     tft_.fillRect(0, 24, SCREEN_W, SCREEN_H - 24, BG);
+    tft_.drawRect(4, 26, SCREEN_W - 8, 188, 0x4B3B);
+    for (HomeRow &row : homeRows_) {
+      row.frame.invalidate();
+      row.glyph.invalidate();
+      row.name.invalidate();
+      row.balance.invalidate();
+      row.rank.invalidate();
+      row.net.invalidate();
+    }
+    homeEmpty_.invalidate();
+    homeHint_.invalidate();
+    homeFlash_.invalidate();
   }
 
-  const int x = 116;
-  const int y = 52;
-  const int w = 86;
-  const int h = 136;
-  const int step = 8;
-  const int dash = 4;
-  const int phase = (millis() / 120) % 2;
+  // Leader first; rank order and net worth are kept by GameLogic. Rows are
+  // slots, so a rent payment only repaints the digits that moved.
+  uint8_t shown = 0;
+  for (uint8_t r = 0; r < game.rankCount() && shown < HOME_ROWS; r++) {
+    const uint8_t i = game.rankOrder()[r];
+    if (!players[i].active || players[i].bankrupt) continue;
+    if (shown == 0) homeEmpty_.clear(tft_, BG);
+    HomeRow &row = homeRows_[shown];
+    int16_t x, y, w;
+    homeSlot(shown, x, y, w);
+    const uint16_t c = playerColor(players[i].id);
+    row.frame.draw(tft_, x, y - 2, w, 36, 6, c, BG);
+    row.glyph.draw(tft_, drawTokenGlyph, players[i].id, c, BG);
+    row.name.drawInt(tft_, compact ? "P" : "Player ", players[i].id, c, BG);
+    row.balance.drawInt(tft_, "", players[i].balance, MONEY, BG);
+    row.rank.drawInt(tft_, "#", r + 1, FG, BG);
+    row.net.drawInt(tft_, "net ", game.netWorth(players[i].id), 0xBDF7, BG);
+    shown++;
+  }
+  for (uint8_t r = shown; r < HOME_ROWS; r++) {
+    HomeRow &row = homeRows_[r];
+    row.frame.clear(tft_, BG);
+    row.glyph.clear(tft_, BG);
+    row.name.clear(tft_, BG);
+    row.balance.clear(tft_, BG);
+    row.rank.clear(tft_, BG);
+    row.net.clear(tft_, BG);
+  }
 
-  if (!fullRedraw) {
-    tft_.fillRect(x - 2, y - 2, w + 6, h + 6, BG);
-    tft_.fillRect(88, 28, 140, 20, BG);
-    tft_.fillRect(0, 210, SCREEN_W, 30, BG);
+  if (shown == 0) {
+    homeEmpty_.draw(tft_, "tap player card", FG, BG);
   }
 
-  tft_.setTextSize(2);
-  tft_.setTextColor(FG);
-  tft_.setCursor(96, 30);
-  tft_.print("TAP CARD");
+  homeHint_.draw(tft_, "X:back   M:menu   Y:select", 0xBDF7, BG);
+  homeFlash_.draw(tft_, game.context().flash, WARN, BG);
+}
 
-  for (int i = 0; i < w; i += step) {
-    if (((i / step) + phase) % 2 == 0) {
-      tft_.drawFastHLine(x + i, y, dash, FG);
-      tft_.drawFastHLine(x + i, y + h, dash, FG);
-    }
-  }
-  for (int i = 0; i < h; i += step) {
-    if (((i / step) + phase) % 2 == 0) {
-      tft_.drawFastVLine(x, y + i, dash, FG);
-      tft_.drawFastVLine(x + w, y + i, dash, FG);
-    }
-  }
+void DisplayUi::animWaitBorder(void *self, uint32_t frame) {
+  DisplayUi &ui = *static_cast<DisplayUi *>(self);
+  const uint8_t phase = frame % 2;
+  drawWaitDashes(ui.tft_, phase ^ 1, BG);
+  drawWaitDashes(ui.tft_, phase, FG);
+}
 
-  if (((millis() / 300) % 2) == 0) {
-    tft_.setTextSize(1);
+void DisplayUi::animWaitBlink(void *self, uint32_t frame) {
+  DisplayUi &ui = *static_cast<DisplayUi *>(self);
+  ui.tft_.setTextSize(1);
+  ui.tft_.setTextColor(frame % 2 == 0 ? FG : BG, BG);
+  ui.tft_.setCursor(304, 228);
+  ui.tft_.print("x");
+}
+
+void DisplayUi::drawWaitCard(const ActionContext &ctx, bool fullRedraw) {
+  if (fullRedraw) {
+    tft_.fillRect(0, 24, SCREEN_W, SCREEN_H - 24, BG);
+    tft_.setTextSize(2);
     tft_.setTextColor(FG);
-    tft_.setCursor(304, 228);
-    tft_.print("x");
+    tft_.setCursor(96, 30);
+    tft_.print("TAP CARD");
+    drawWaitDashes(tft_, 0, FG);
+    animWaitBlink(this, 0);
+    anims_.add(120, animWaitBorder, this);
+    anims_.add(300, animWaitBlink, this);
+    waitReason_.invalidate();
+    waitNoCancel_.invalidate();
   }
 
-  tft_.setTextSize(1);
-  tft_.setCursor(8, 212);
   if (ctx.waitReason == WaitReason::BUY_PLAYER) {
-    tft_.print("waiting bank card for purchase");
+    waitReason_.draw(tft_, "waiting bank card for purchase", FG, BG);
   } else if (ctx.waitReason == WaitReason::RENT_PAYER) {
-    tft_.print("waiting payer bank card");
+    waitReason_.draw(tft_, "waiting payer bank card", FG, BG);
   } else if (ctx.waitReason == WaitReason::EVENT_TARGET) {
-    tft_.print("waiting target bank card");
+    waitReason_.draw(tft_, "waiting target bank card", FG, BG);
   } else {
-    tft_.print("waiting card...");
-  }
-
-  if (ctx.noCancel) {
-    tft_.setTextSize(1);
-    tft_.setCursor(8, 228);
-    tft_.print("no cancel");
+    waitReason_.draw(tft_, "waiting card...", FG, BG);
   }
+  waitNoCancel_.draw(tft_, ctx.noCancel ? "no cancel" : "", FG, BG);
 }
 
 void DisplayUi::drawPropertyUnowned(const GameLogic &game, const ActionContext &ctx) {
@@ -309,25 +437,30 @@ void DisplayUi::drawEvent(const ActionContext &ctx) {
   tft_.print("apply then tap bank card");
 }
 
-void DisplayUi::drawAuction(const ActionContext &ctx) {
-  tft_.fillRect(0, 24, SCREEN_W, SCREEN_H - 24, BG);
-  tft_.setTextColor(FG);
-  tft_.drawRect(6, 28, SCREEN_W - 12, 176, FG);
-  tft_.setTextSize(2);
-  tft_.setCursor(10, 64);
-  tft_.print("auction");
-  tft_.setCursor(180, 64);
-  tft_.print(ctx.auctionSecondsLeft);
-  tft_.setTextSize(3);
-  tft_.setCursor(10, 114);
-  tft_.print(ctx.auctionBid);
-  tft_.setTextSize(1);
-  tft_.setCursor(8, 212);
-  if (ctx.auctionAwaitWinner) {
-    tft_.print("winner tap bank card");
-  } else {
-    tft_.print("X back   M menu   Y +20");
+void DisplayUi::animAuction(void *self, uint32_t frame) {
+  (void)frame;
+  DisplayUi &ui = *static_cast<DisplayUi *>(self);
+  if (!ui.game_) return;
+  ui.auctionSeconds_.drawInt(ui.tft_, "", ui.game_->context().auctionSecondsLeft, FG, BG);
+}
+
+void DisplayUi::drawAuction(const ActionContext &ctx, bool fullRedraw) {
+  if (fullRedraw) {
+    tft_.fillRect(0, 24, SCREEN_W, SCREEN_H - 24, BG);
+    tft_.setTextColor(FG);
+    tft_.drawRect(6, 28, SCREEN_W - 12, 176, FG);
+    tft_.setTextSize(2);
+    tft_.setCursor(10, 64);
+    tft_.print("auction");
+    auctionSeconds_.invalidate();
+    auctionBid_.invalidate();
+    auctionHint_.invalidate();
+    // Countdown follows GameLogic's clock, not the render that made it dirty
+    anims_.add(250, animAuction, this);
   }
+  auctionSeconds_.drawInt(tft_, "", ctx.auctionSecondsLeft, FG, BG);
+  auctionBid_.drawInt(tft_, "", ctx.auctionBid, FG, BG);
+  auctionHint_.draw(tft_, ctx.auctionAwaitWinner ? "winner tap bank card" : "X back   M menu   Y +20", FG, BG);
 }
 
 void DisplayUi::drawDebt(const ActionContext &ctx) {
@@ -411,6 +544,25 @@ void DisplayUi::drawWinner(const GameLogic &game, const ActionContext &ctx) {
   tft_.setTextSize(2);
   tft_.setCursor(10, 170);
   tft_.print("winner");
+
+  const GameStats &stats = game.stats();
+  tft_.setTextSize(1);
+  tft_.setCursor(10, 36);
+  tft_.print("actions ");
+  tft_.print(stats.actions());
+  tft_.print("  avg ");
+  tft_.print(stats.avgActionMs() / 1000);
+  tft_.print("s  max ");
+  tft_.print(stats.maxActionMs() / 1000);
+  tft_.print("s");
+  const uint8_t top = stats.topRentProperty();
+  if (top != 0) {
+    tft_.setCursor(10, 50);
+    tft_.print("top rent P");
+    tft_.print(top);
+    tft_.print("  $");
+    tft_.print(stats.rentByProperty(top));
+  }
 }
 
 void DisplayUi::render(const GameLogic &game, float batteryPercent) {
@@ -419,15 +571,20 @@ void DisplayUi::render(const GameLogic &game, float batteryPercent) {
   const bool stateChanged = !hasLastState_ || nowState != lastState_;
   const bool batteryChanged = nowBattery != lastBattery_;
 
+  beginFrame();
+  game_ = &game;
+  if (stateChanged) {
+    anims_.clear();
+  }
   if (stateChanged || batteryChanged) {
-    drawStatusBar(nowState, batteryPercent);
+    drawStatusBar(nowState, batteryPercent, !hasLastState_);
     lastBattery_ = nowBattery;
   }
 
   if (stateChanged) {
     switch (nowState) {
       case UiState::HOME:
-        drawHome(game);
+        drawHome(game, true);
         break;
       case UiState::WAIT_CARD:
         drawWaitCard(game.context(), true);
@@ -442,7 +599,7 @@ void DisplayUi::render(const GameLogic &game, float batteryPercent) {
         drawEvent(game.context());
         break;
       case UiState::AUCTION:
-        drawAuction(game.context());
+        drawAuction(game.context(), true);
         break;
       case UiState::DEBT:
         drawDebt(game.context());
@@ -469,8 +626,8 @@ void DisplayUi::render(const GameLogic &game, float batteryPercent) {
       case UiState::HOME:
       case UiState::DEBT:
         // these can change in-place while state remains same
-        if (nowState == UiState::AUCTION) drawAuction(game.context());
-        if (nowState == UiState::HOME) drawHome(game);
+        if (nowState == UiState::AUCTION) drawAuction(game.context(), false);
+        if (nowState == UiState::HOME) drawHome(game, false);
         if (nowState == UiState::DEBT) drawDebt(game.context());
         break;
       default:
@@ -480,9 +637,11 @@ void DisplayUi::render(const GameLogic &game, float batteryPercent) {
 
   hasLastState_ = true;
   lastState_ = nowState;
+  endFrame();
 }
 
 void DisplayUi::renderProgramming(const char *category, uint8_t itemId, const char *detail, bool armWrite, const char *message) {
+  beginFrame();
   (void)category;
   (void)itemId;
   (void)detail;
@@ -524,9 +683,11 @@ void DisplayUi::renderProgramming(const char *category, uint8_t itemId, const ch
     tft_.setCursor(8, 124);
     tft_.print(message);
   }
+  endFrame();
 }
 
-void DisplayUi::renderLobby(uint8_t registeredCount, uint8_t requiredCount, const bool activePlayers[GAME_MAX_PLAYERS], bool fundingStage, const char *message) {
+void DisplayUi::renderLobby(uint8_t registeredCount, uint8_t requiredCount, PlayerMask activePlayers, bool fundingStage, const char *message) {
+  beginFrame();
   clearMain();
   tft_.fillRect(0, 0, SCREEN_W, 22, ACCENT);
   tft_.drawFastHLine(0, 22, SCREEN_W, 0x4B3B);
@@ -546,16 +707,19 @@ void DisplayUi::renderLobby(uint8_t registeredCount, uint8_t requiredCount, cons
   tft_.print('/');
   tft_.print(requiredCount);
 
-  int y = 120;
+  // Registered tokens, four to a line
+  uint8_t shown = 0;
   tft_.setTextSize(2);
-  for (uint8_t i = 0; i < GAME_MAX_PLAYERS; i++) {
-    if (!activePlayers[i]) continue;
-    uint16_t c = playerColor(i + 1);
-    drawTokenGlyph(tft_, 12, y + 4, i + 1, c);
+  for (uint8_t id = 1; id <= GAME_MAX_PLAYERS; id++) {
+    if (!(activePlayers & playerBit(id))) continue;
+    const int16_t x = 12 + 76 * (shown % 4);
+    const int16_t y = 120 + 32 * (shown / 4);
+    uint16_t c = playerColor(id);
+    drawTokenGlyph(tft_, x, y + 4, id, c);
     tft_.setTextColor(c);
-    tft_.setCursor(34, y);
-    tft_.print(i + 1);
-    y += 24;
+    tft_.setCursor(x + 22, y);
+    tft_.print(id);
+    shown++;
   }
   tft_.setTextColor(FG);
 
@@ -573,9 +737,11 @@ void DisplayUi::renderLobby(uint8_t registeredCount, uint8_t requiredCount, cons
     tft_.setCursor(150, 228);
     tft_.print(message);
   }
+  endFrame();
 }
 
 void DisplayUi::renderActionMenu(uint8_t selected) {
+  beginFrame();
   clearMain();
   tft_.fillRect(0, 0, SCREEN_W, 22, ACCENT);
   tft_.drawFastHLine(0, 22, SCREEN_W, 0x4B3B);
@@ -603,4 +769,5 @@ void DisplayUi::renderActionMenu(uint8_t selected) {
   tft_.setTextSize(1);
   tft_.setCursor(8, 212);
   tft_.print("X:close  M:next  Y:select");
+  endFrame();
 }
@@ -0,0 +1,322 @@
+#include "frame_canvas.h"
+
+#include <esp_heap_caps.h>
+
+namespace {
+inline uint16_t toPanel(uint16_t c) {
+  return static_cast<uint16_t>((c << 8) | (c >> 8));
+}
+}  // namespace
+
+bool FrameCanvas::begin() {
+  for (int8_t &o : owner_) o = -1;
+#if TFT_FRAMEBUFFER
+  const size_t bytes = static_cast<size_t>(TFT_BAND_BUFFERS) * WIDTH * TFT_BAND_ROWS * sizeof(uint16_t);
+  pool_ = static_cast<uint16_t *>(heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+#endif
+#if TFT_GLYPH_CACHE
+  useAtlas_ = atlas_.begin();
+#endif
+  return pool_ != nullptr;
+}
+
+uint16_t *FrameCanvas::row(uint8_t band, int16_t y) {
+  const int32_t base = static_cast<int32_t>(bands_[band].slot) * _width * TFT_BAND_ROWS;
+  return pool_ + base + static_cast<int32_t>(y - band * TFT_BAND_ROWS) * _width;
+}
+
+bool FrameCanvas::painted(uint8_t band, const Rect &r) const {
+  const Band &b = bands_[band];
+  for (uint8_t i = 0; i < b.count; i++) {
+    if (contains(b.rects[i], r)) return true;
+  }
+  return false;
+}
+
+// Gives the band a buffer, flushing the least recently drawn band if needed
+void FrameCanvas::claim(uint8_t band) {
+  Band &b = bands_[band];
+  b.used = ++stamp_;
+  if (b.slot >= 0) return;
+  int8_t slot = -1;
+  for (uint8_t i = 0; i < TFT_BAND_BUFFERS && slot < 0; i++) {
+    if (owner_[i] < 0) slot = i;
+  }
+  if (slot < 0) {
+    uint8_t victim = owner_[0];
+    for (uint8_t i = 1; i < TFT_BAND_BUFFERS; i++) {
+      if (bands_[owner_[i]].used < bands_[victim].used) victim = owner_[i];
+    }
+    sent_ += flushBand(victim);
+    slot = bands_[victim].slot;
+    bands_[victim].slot = -1;
+  }
+  owner_[slot] = band;
+  b.slot = slot;
+}
+
+// r has just been painted in full; merge it only where the result is still
+// a fully painted rectangle
+void FrameCanvas::paint(uint8_t band, Rect r) {
+  Band &b = bands_[band];
+  for (uint8_t i = 0; i < b.count;) {
+    const Rect &e = b.rects[i];
+    if (contains(e, r)) return;
+    const bool sideBySide = e.y0 == r.y0 && e.y1 == r.y1 && r.x0 <= e.x1 + 1 && e.x0 <= r.x1 + 1;
+    const bool stacked = e.x0 == r.x0 && e.x1 == r.x1 && r.y0 <= e.y1 + 1 && e.y0 <= r.y1 + 1;
+    if (contains(r, e) || sideBySide || stacked) {
+      r = {min(r.x0, e.x0), min(r.y0, e.y0), max(r.x1, e.x1), max(r.y1, e.y1)};
+      b.rects[i] = b.rects[--b.count];
+      i = 0;  // the union may now take in another rect
+      continue;
+    }
+    i++;
+  }
+  if (b.count == TFT_BAND_RECTS) sent_ += flushBand(band);
+  b.rects[b.count++] = r;
+}
+
+uint32_t FrameCanvas::flushBand(uint8_t band) {
+  Band &b = bands_[band];
+  uint32_t sent = 0;
+  if (b.count == 0) return 0;
+  panel_.startWrite();
+  for (uint8_t i = 0; i < b.count; i++) {
+    const Rect &r = b.rects[i];
+    const int16_t w = r.x1 - r.x0 + 1;
+    const int16_t h = r.y1 - r.y0 + 1;
+    panel_.setAddrWindow(r.x0, r.y0, w, h);
+    if (w == _width) {
+      // Full-width rows are contiguous in the band buffer
+      panel_.writePixels(row(band, r.y0), static_cast<uint32_t>(w) * h, true, true);
+    } else {
+      for (int16_t y = r.y0; y <= r.y1; y++) panel_.writePixels(row(band, y) + r.x0, w, true, true);
+    }
+    sent += static_cast<uint32_t>(w) * h;
+  }
+  panel_.endWrite();
+  b.count = 0;
+  return sent;
+}
+
+// Drawn, but not a painted rect (a pixel, a run of transparent text): the
+// band's copy is kept current, and the panel gets it directly unless a
+// painted rect will carry it. Clipped by the caller.
+void FrameCanvas::fillLoose(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  const uint16_t c = toPanel(color);
+  for (uint8_t band = y0 / TFT_BAND_ROWS; band <= y1 / TFT_BAND_ROWS; band++) {
+    const int16_t r0 = max<int16_t>(y0, band * TFT_BAND_ROWS);
+    const int16_t r1 = min<int16_t>(y1, band * TFT_BAND_ROWS + TFT_BAND_ROWS - 1);
+    if (bands_[band].slot >= 0) {
+      for (int16_t r = r0; r <= r1; r++) {
+        uint16_t *p = row(band, r) + x0;
+        for (int16_t i = x0; i <= x1; i++) *p++ = c;
+      }
+    }
+    if (!painted(band, {x0, r0, x1, r1})) panel_.fillRect(x0, r0, x1 - x0 + 1, r1 - r0 + 1, color);
+  }
+}
+
+void FrameCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (!pool_) {
+    panel_.drawPixel(x, y, color);
+    return;
+  }
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+  fillLoose(x, y, x, y, color);
+}
+
+void FrameCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (!pool_) {
+    panel_.fillRect(x, y, w, h, color);
+    return;
+  }
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  int16_t x1 = x + w - 1;
+  int16_t y1 = y + h - 1;
+  if (x < 0) x = 0;
+  if (y < 0) y = 0;
+  if (x1 >= _width) x1 = _width - 1;
+  if (y1 >= _height) y1 = _height - 1;
+  if (x1 < x || y1 < y) return;
+
+  const uint16_t c = toPanel(color);
+  for (uint8_t band = y / TFT_BAND_ROWS; band <= y1 / TFT_BAND_ROWS; band++) {
+    const int16_t r0 = max<int16_t>(y, band * TFT_BAND_ROWS);
+    const int16_t r1 = min<int16_t>(y1, band * TFT_BAND_ROWS + TFT_BAND_ROWS - 1);
+    claim(band);
+    for (int16_t r = r0; r <= r1; r++) {
+      uint16_t *p = row(band, r) + x;
+      for (int16_t i = x; i <= x1; i++) *p++ = c;
+    }
+    paint(band, {x, r0, x1, r1});
+  }
+}
+
+void FrameCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void FrameCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void FrameCanvas::fillScreen(uint16_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+uint32_t FrameCanvas::flush() {
+  if (!pool_) return 0;
+  uint32_t sent = sent_;
+  sent_ = 0;
+  for (uint8_t band = 0; band < BANDS; band++) {
+    sent += flushBand(band);
+    if (bands_[band].slot >= 0) owner_[bands_[band].slot] = -1;
+    bands_[band].slot = -1;
+  }
+  return sent;
+}
+
+size_t FrameCanvas::write(uint8_t c) {
+  writeText(&c, 1);
+  return 1;
+}
+
+size_t FrameCanvas::write(const uint8_t *buffer, size_t size) {
+  writeText(buffer, size);
+  return size;
+}
+
+void FrameCanvas::writeText(const uint8_t *s, size_t n) {
+  const uint32_t t0 = micros();
+  text.chars += n;
+
+  const uint8_t size = textsize_x;
+  if (!useAtlas_ || gfxFont || size != textsize_y || size > GlyphAtlas::MAX_SIZE) {
+    for (size_t i = 0; i < n; i++) Adafruit_GFX::write(s[i]);
+    text.micros += micros() - t0;
+    return;
+  }
+
+  // Same cursor / wrap rules as Adafruit_GFX::write, but consecutive
+  // printable characters on one line are blitted together.
+  const int16_t cw = 6 * size;
+  size_t runStart = 0;
+  uint8_t runLen = 0;
+  int16_t runX = cursor_x;
+  for (size_t i = 0; i < n; i++) {
+    const uint8_t c = s[i];
+    const bool glyph = atlas_.has(size, c);
+    const bool wraps = wrap && c != '\n' && c != '\r' && cursor_x + cw > _width;
+    if (runLen > 0 && (!glyph || wraps || runLen == 255)) {
+      blitRun(runX, cursor_y, s + runStart, runLen, size);
+      runLen = 0;
+    }
+    if (!glyph) {
+      Adafruit_GFX::write(c);
+      continue;
+    }
+    if (wraps) {
+      cursor_x = 0;
+      cursor_y += 8 * size;
+    }
+    if (runLen == 0) {
+      runStart = i;
+      runX = cursor_x;
+    }
+    runLen++;
+    cursor_x += cw;
+  }
+  if (runLen > 0) blitRun(runX, cursor_y, s + runStart, runLen, size);
+  text.micros += micros() - t0;
+}
+
+void FrameCanvas::blitRun(int16_t x, int16_t y, const uint8_t *s, uint8_t n, uint8_t size) {
+  const int16_t cw = 6 * size;
+  const int16_t ch = 8 * size;
+  const bool opaque = textbgcolor != textcolor;
+  const uint8_t rowBytes = GlyphAtlas::rowBytes(size);
+
+  // Clip to the screen in whole pixels
+  const int16_t x0 = x < 0 ? 0 : x;
+  const int16_t y0 = y < 0 ? 0 : y;
+  int16_t x1 = x + cw * n - 1;
+  int16_t y1 = y + ch - 1;
+  if (x1 >= _width) x1 = _width - 1;
+  if (y1 >= _height) y1 = _height - 1;
+  if (x1 < x0 || y1 < y0) return;
+
+  if (pool_) {
+    blitBands(x, y, s, size, x0, y0, x1, y1, opaque);
+    return;
+  }
+  if (!opaque) {
+    // No buffer to read back: transparent text has to go pixel by pixel
+    for (uint8_t i = 0; i < n; i++) drawChar(x + cw * i, y, s[i], textcolor, textbgcolor, size, size);
+    return;
+  }
+
+  panel_.startWrite();
+  panel_.setAddrWindow(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+  for (int16_t py = y0; py <= y1; py++) {
+    const uint8_t *bits = nullptr;
+    for (int16_t px = x0; px <= x1; px++) {
+      const int16_t gx = (px - x) % cw;
+      if (px == x0 || gx == 0) bits = atlas_.glyph(size, s[(px - x) / cw]) + (py - y) * rowBytes;
+      line_[px - x0] = (bits[gx >> 3] & (0x80 >> (gx & 7))) ? textcolor : textbgcolor;
+    }
+    panel_.writePixels(line_, x1 - x0 + 1, true, false);
+  }
+  panel_.endWrite();
+}
+
+// Opaque text is a painted rect. Transparent text over rects this frame
+// painted only changes the buffers; elsewhere its runs of set pixels are
+// drawn loose. blitRun() clips x1 to the run, so every glyph index is in s.
+void FrameCanvas::blitBands(int16_t x, int16_t y, const uint8_t *s, uint8_t size, int16_t x0, int16_t y0, int16_t x1,
+                            int16_t y1, bool opaque) {
+  const int16_t cw = 6 * size;
+  const uint8_t rowBytes = GlyphAtlas::rowBytes(size);
+  const uint16_t fg = toPanel(textcolor);
+  const uint16_t bg = toPanel(textbgcolor);
+  for (uint8_t band = y0 / TFT_BAND_ROWS; band <= y1 / TFT_BAND_ROWS; band++) {
+    const int16_t r0 = max<int16_t>(y0, band * TFT_BAND_ROWS);
+    const int16_t r1 = min<int16_t>(y1, band * TFT_BAND_ROWS + TFT_BAND_ROWS - 1);
+    const bool over = !opaque && painted(band, {x0, r0, x1, r1});
+    if (opaque) claim(band);
+    for (int16_t py = r0; py <= r1; py++) {
+      uint16_t *out = (opaque || over) ? row(band, py) : nullptr;
+      const uint8_t *bits = nullptr;
+      int16_t runX = -1;  // start of the current run of set pixels, loose path
+      for (int16_t px = x0; px <= x1 + 1; px++) {
+        bool on = false;
+        if (px <= x1) {
+          const int16_t gx = (px - x) % cw;
+          if (px == x0 || gx == 0) bits = atlas_.glyph(size, s[(px - x) / cw]) + (py - y) * rowBytes;
+          on = bits[gx >> 3] & (0x80 >> (gx & 7));
+        }
+        if (out) {
+          if (px > x1) break;
+          if (on) {
+            out[px] = fg;
+          } else if (opaque) {
+            out[px] = bg;
+          }
+        } else if (on && runX < 0) {
+          runX = px;
+        } else if (!on && runX >= 0) {
+          fillLoose(runX, py, px - 1, py, textcolor);
+          runX = -1;
+        }
+      }
+    }
+    if (opaque) paint(band, {x0, r0, x1, r1});
+  }
+}
@@ -5,6 +5,8 @@
 
 namespace {
 constexpr uint8_t kMaxLevel = 5;
+constexpr uint32_t kEventRevealMs = 800;
+constexpr uint32_t kAuctionStepMs = 1000;
 
 constexpr uint8_t kPropertyTableCount = 22;
 constexpr uint16_t kPropertyLevelValues[kPropertyTableCount][kMaxLevel] = {
@@ -64,13 +66,17 @@ const EventCardData kDefaultEvents[] = {
     makeEvent(6, EventType::MONEY, -200),
 };
 
+// Sequence numbers wrap; a is newer when it is less than half the range ahead
+bool seqAfter(uint16_t a, uint16_t b) { return static_cast<int16_t>(a - b) > 0; }
+
 void setFlash(ActionContext &ctx, const char *text) {
   strncpy(ctx.flash, text, sizeof(ctx.flash) - 1);
   ctx.flash[sizeof(ctx.flash) - 1] = '\0';
 }
 }  // namespace
 
-void GameLogic::begin() {
+void GameLogic::begin(TimerWheel &timers) {
+  timers_ = &timers;
   for (uint8_t i = 0; i < PROPERTY_COUNT; i++) {
     const uint8_t id = i + 1;
     const uint16_t price = propertyValueByLevel(id, 1);
@@ -80,25 +86,167 @@ void GameLogic::begin() {
     properties_[i].basePrice = price;
     properties_[i].baseRent = price;
   }
-  for (uint8_t i = 0; i < PROPERTY_COUNT; i++) {
-    propertyDirty_[i] = false;
-  }
+  dirtyProperties_ = 0;
+  stats_.reset();
   setState(UiState::HOME);
 }
 
+static_assert(PROPERTY_COUNT <= 32, "dirtyProperties_ holds one bit per property");
+
+void GameLogic::markPlayerDirty(uint8_t playerId) {
+  if (playerId < 1 || playerId > GAME_MAX_PLAYERS) return;
+  playerSeq_[playerId - 1]++;
+  dirtyPlayers_ |= playerBit(playerId);
+}
+
 void GameLogic::markPropertyDirty(uint8_t propertyId) {
-  (void)propertyId;
+  if (propertyId < 1 || propertyId > PROPERTY_COUNT) return;
+  propertySeq_[propertyId - 1]++;
+  dirtyProperties_ |= 1UL << (propertyId - 1);
+}
+
+uint8_t GameLogic::queuedWrites() const {
+  return static_cast<uint8_t>(__builtin_popcount(dirtyPlayers_) + __builtin_popcount(dirtyProperties_));
+}
+
+// Bankrupt players trail; otherwise richer first, lower id on ties.
+bool GameLogic::ahead(uint8_t a, uint8_t b) const {
+  if (players_[a].bankrupt != players_[b].bankrupt) return !players_[a].bankrupt;
+  if (netWorth_[a] != netWorth_[b]) return netWorth_[a] > netWorth_[b];
+  return a < b;
+}
+
+// Only this player's value changed, so walk it up or down into place.
+void GameLogic::rerank(uint8_t index) {
+  if (!players_[index].active) return;
+  uint8_t r = rank_[index];
+  while (r > 0 && ahead(index, rankOrder_[r - 1])) {
+    rankOrder_[r] = rankOrder_[r - 1];
+    rank_[rankOrder_[r]] = r;
+    r--;
+  }
+  while (r + 1 < rankCount_ && ahead(rankOrder_[r + 1], index)) {
+    rankOrder_[r] = rankOrder_[r + 1];
+    rank_[rankOrder_[r]] = r;
+    r++;
+  }
+  rankOrder_[r] = index;
+  rank_[index] = r;
+}
+
+void GameLogic::adjustBalance(PlayerState &player, int32_t delta) {
+  if (delta == 0) return;
+  player.balance += delta;
+  markPlayerDirty(player.id);
+  netWorth_[player.id - 1] += delta;
+  rerank(player.id - 1);
+}
+
+void GameLogic::setBalance(PlayerState &player, int32_t balance) {
+  adjustBalance(player, balance - player.balance);
+}
+
+void GameLogic::setOwner(PropertyState &prop, uint8_t ownerId) {
+  const uint8_t prev = prop.ownerId;
+  if (prev == ownerId) return;
+  prop.ownerId = ownerId;
+  if (prev >= 1 && prev <= GAME_MAX_PLAYERS) {
+    netWorth_[prev - 1] -= prop.basePrice;
+    rerank(prev - 1);
+  }
+  if (ownerId >= 1 && ownerId <= GAME_MAX_PLAYERS) {
+    netWorth_[ownerId - 1] += prop.basePrice;
+    rerank(ownerId - 1);
+  }
+}
+
+void GameLogic::setBasePrice(PropertyState &prop, uint16_t price) {
+  if (prop.ownerId >= 1 && prop.ownerId <= GAME_MAX_PLAYERS) {
+    netWorth_[prop.ownerId - 1] += static_cast<int32_t>(price) - prop.basePrice;
+    rerank(prop.ownerId - 1);
+  }
+  prop.basePrice = price;
+  prop.baseRent = price;
+}
+
+void GameLogic::setBankrupt(PlayerState &player, bool bankrupt) {
+  if (player.bankrupt == bankrupt) return;
+  player.bankrupt = bankrupt;
+  markPlayerDirty(player.id);
+  rerank(player.id - 1);
+}
+
+void GameLogic::setJailed(PlayerState &player, bool jailed) {
+  if (player.jailed == jailed) return;
+  player.jailed = jailed;
+  markPlayerDirty(player.id);
+}
+
+int32_t GameLogic::netWorth(uint8_t playerId) const {
+  if (playerId < 1 || playerId > GAME_MAX_PLAYERS) return 0;
+  return netWorth_[playerId - 1];
+}
+
+uint8_t GameLogic::rank(uint8_t playerId) const {
+  if (playerId < 1 || playerId > GAME_MAX_PLAYERS) return 0;
+  if (!players_[playerId - 1].active) return 0;
+  return rank_[playerId - 1] + 1;
 }
 
 void GameLogic::setState(UiState next) {
+  // Every trip away from HOME and back counts as one action
+  if (state_ == UiState::HOME && next != UiState::HOME) {
+    stats_.onActionStart();
+  } else if (state_ != UiState::HOME && next == UiState::HOME) {
+    stats_.onActionEnd(players_);
+  }
   state_ = next;
-  stateSinceMs_ = millis();
-  if (state_ == UiState::AUCTION) {
-    lastAuctionTickMs_ = millis();
+  // Entering a state (again) restarts its deadline
+  switch (state_) {
+    case UiState::WAIT_CARD:
+    case UiState::GO:
+    case UiState::TRAIN:
+    case UiState::JAIL:
+      armState(WAIT_TIMEOUT_MS);
+      break;
+    case UiState::EVENT:
+      armState(kEventRevealMs);
+      break;
+    case UiState::AUCTION:
+      armState(kAuctionStepMs);
+      break;
+    default:
+      armState(0);
+      break;
   }
   dirty_ = true;
 }
 
+// 0 = no deadline
+void GameLogic::armState(uint32_t delayMs) {
+  if (!timers_) return;
+  timers_->cancel(stateTimer_);
+  heldLeftMs_ = delayMs;
+  if (delayMs > 0 && !held_) stateTimer_ = timers_->start(delayMs, onStateTimer, this);
+}
+
+void GameLogic::onStateTimer(void *self) {
+  GameLogic *game = static_cast<GameLogic *>(self);
+  game->heldLeftMs_ = 0;
+  game->dispatch(GameInput::TICK);
+}
+
+void GameLogic::hold(bool held) {
+  if (held == held_ || !timers_) return;
+  held_ = held;
+  if (held_) {
+    heldLeftMs_ = timers_->pending(stateTimer_) ? timers_->msLeft(stateTimer_, millis()) : 0;
+    timers_->cancel(stateTimer_);
+  } else if (heldLeftMs_ > 0) {
+    stateTimer_ = timers_->start(heldLeftMs_, onStateTimer, this);
+  }
+}
+
 void GameLogic::touchState() {
   dirty_ = true;
 }
@@ -110,6 +258,14 @@ void GameLogic::ensurePlayer(uint8_t playerId) {
     p.active = true;
     p.id = playerId;
     p.balance = 1500;
+    markPlayerDirty(playerId);
+    netWorth_[playerId - 1] = p.balance;
+    for (uint8_t i = 0; i < PROPERTY_COUNT; i++) {
+      if (properties_[i].ownerId == playerId) netWorth_[playerId - 1] += properties_[i].basePrice;
+    }
+    rank_[playerId - 1] = rankCount_;
+    rankOrder_[rankCount_++] = playerId - 1;
+    rerank(playerId - 1);
   }
 }
 
@@ -171,7 +327,7 @@ void GameLogic::settleDebtWithProperty(uint8_t propertyId) {
   if (!prop) return;
   if (prop->ownerId != ctx_.debtorId) return;
 
-  prop->ownerId = ctx_.creditorId;
+  setOwner(*prop, ctx_.creditorId);
   if (ctx_.creditorId == 0) prop->level = 1;
   markPropertyDirty(prop->id);
 
@@ -186,7 +342,7 @@ void GameLogic::settleDebtWithProperty(uint8_t propertyId) {
   PlayerState *debtor = playerById(ctx_.debtorId);
   if (!debtor) return;
   if (debtor->balance <= 0 && firstOwnedProperty(debtor->id) == 0) {
-    debtor->bankrupt = true;
+    setBankrupt(*debtor, true);
     resolveWinner();
     if (state_ != UiState::WINNER) {
       ctx_ = {};
@@ -203,7 +359,7 @@ void GameLogic::applyEventToPlayer(const EventCardData &event, uint8_t playerId)
 
   if (event.type == EventType::MONEY) {
     if (event.value >= 0) {
-      p->balance += event.value;
+      adjustBalance(*p, event.value);
       ctx_ = {};
       setFlash(ctx_, "+MONEY");
       setState(UiState::HOME);
@@ -211,20 +367,20 @@ void GameLogic::applyEventToPlayer(const EventCardData &event, uint8_t playerId)
     }
     const int32_t owed = -event.value;
     if (p->balance >= owed) {
-      p->balance -= owed;
+      adjustBalance(*p, -owed);
       ctx_ = {};
       setFlash(ctx_, "-MONEY");
       setState(UiState::HOME);
       return;
     }
     const int32_t left = owed - p->balance;
-    p->balance = 0;
+    setBalance(*p, 0);
     enterDebt(p->id, 0, left);
     return;
   }
 
   if (event.type == EventType::JAIL) {
-    p->jailed = true;
+    setJailed(*p, true);
     ctx_ = {};
     setFlash(ctx_, "GO JAIL");
     setState(UiState::HOME);
@@ -257,62 +413,224 @@ void GameLogic::primePlayer(uint8_t playerId, int32_t balance) {
   ensurePlayer(playerId);
   PlayerState *p = playerById(playerId);
   if (!p) return;
-  p->balance = balance;
-  p->jailed = false;
-  p->bankrupt = false;
+  setBalance(*p, balance);
+  setJailed(*p, false);
+  setBankrupt(*p, false);
   touchState();
 }
 
-void GameLogic::onBtn1() {
-  if (state_ == UiState::HOME) {
-    ctx_ = {};
-    setState(UiState::GO);
-    return;
+void GameLogic::restorePlayer(const PlayerCardData &card) {
+  primePlayer(card.playerId, card.balance);
+  PlayerState *p = playerById(card.playerId);
+  if (!p) return;
+  setJailed(*p, card.jailed);
+  setBankrupt(*p, card.bankrupt);
+  playerSeq_[card.playerId - 1] = card.seq;
+  dirtyPlayers_ &= ~playerBit(card.playerId);
+}
+
+// =============================================================================
+// TRANSITION TABLE
+// =============================================================================
+// Every UiState x GameInput cell names its handler; &GameLogic::ignore marks
+// the inputs a state does not react to, so an empty cell is a build error.
+#define H(fn) &GameLogic::fn
+struct GameTransitions {
+  // clang-format off
+  static constexpr GameLogic::Handler kTable[UI_STATE_COUNT][GAME_INPUT_COUNT] = {
+    // BTN1, BTN2, BTN3, MENU, TICK, PLAYER_CARD, PROPERTY_CARD, EVENT_CARD
+    /* HOME */             {H(openGo), H(goHome), H(openJail), H(menuAction), H(ignore), H(flashCard), H(showProperty), H(showEvent)},
+    /* WAIT_CARD */        {H(ignore), H(cancelWait), H(ignore), H(ignore), H(tickTimeout), H(waitCardPlayer), H(showProperty), H(ignore)},
+    /* PROPERTY_UNOWNED */ {H(waitBuyer), H(goHome), H(startPropertyAuction), H(ignore), H(ignore), H(ignore), H(ignore), H(ignore)},
+    /* PROPERTY_OWNED */   {H(waitRentPayer), H(goHome), H(ignore), H(ignore), H(ignore), H(ignore), H(ignore), H(ignore)},
+    /* EVENT */            {H(ignore), H(goHome), H(ignore), H(ignore), H(tickEvent), H(ignore), H(ignore), H(ignore)},
+    /* AUCTION */          {H(raiseBid), H(goHome), H(ignore), H(ignore), H(tickAuction), H(auctionWinner), H(ignore), H(ignore)},
+    /* DEBT */             {H(ignore), H(goHome), H(ignore), H(ignore), H(ignore), H(ignore), H(settleDebt), H(ignore)},
+    /* GO */               {H(ignore), H(goHome), H(ignore), H(ignore), H(tickTimeout), H(collectGo), H(ignore), H(ignore)},
+    /* TRAIN */            {H(ignore), H(goHome), H(ignore), H(ignore), H(tickTimeout), H(payTrain), H(ignore), H(ignore)},
+    /* JAIL */             {H(ignore), H(goHome), H(ignore), H(ignore), H(tickTimeout), H(payJail), H(ignore), H(ignore)},
+    /* WINNER */           {H(ignore), H(ignore), H(ignore), H(ignore), H(ignore), H(ignore), H(ignore), H(ignore)},
+  };
+  // clang-format on
+
+  static constexpr bool complete() {
+    for (uint8_t s = 0; s < UI_STATE_COUNT; s++) {
+      for (uint8_t i = 0; i < GAME_INPUT_COUNT; i++) {
+        if (!kTable[s][i]) return false;
+      }
+    }
+    return true;
   }
-  if (state_ == UiState::PROPERTY_UNOWNED) {
-    ctx_.waitReason = WaitReason::BUY_PLAYER;
-    ctx_.noCancel = false;
-    setState(UiState::WAIT_CARD);
+};
+#undef H
+static_assert(GameTransitions::complete(), "every UiState x GameInput cell needs a handler (use ignore)");
+
+void GameLogic::dispatch(GameInput input, uint8_t arg) {
+  const UiState from = state_;
+  const Handler handler = GameTransitions::kTable[static_cast<uint8_t>(from)][static_cast<uint8_t>(input)];
+  if (handler == &GameLogic::ignore) return;
+  const uint32_t t0 = micros();
+  (this->*handler)(arg);
+  if (hook_) hook_(from, state_, input, micros() - t0);
+}
+
+bool GameLogic::handles(GameInput input) const {
+  return GameTransitions::kTable[static_cast<uint8_t>(state_)][static_cast<uint8_t>(input)] != &GameLogic::ignore;
+}
+
+// =============================================================================
+// INPUTS
+// =============================================================================
+void GameLogic::onBtn1() { dispatch(GameInput::BTN1); }
+void GameLogic::onBtn2() { dispatch(GameInput::BTN2); }
+void GameLogic::onBtn3() { dispatch(GameInput::BTN3); }
+void GameLogic::triggerMenuAction(uint8_t action) { dispatch(GameInput::MENU, action); }
+
+void GameLogic::onPlayerCard(const CardTap &tap, CardManager &cards) {
+  PlayerCardData card{};
+  if (!cards.readPlayer(tap, card)) {
     return;
   }
-  if (state_ == UiState::PROPERTY_OWNED) {
-    ctx_.waitReason = WaitReason::RENT_PAYER;
-    ctx_.noCancel = false;
-    setState(UiState::WAIT_CARD);
+
+  // Any player card joins its player, whatever the screen
+  ensurePlayer(card.playerId);
+  if (!playerById(card.playerId)) return;
+  syncPlayer(card);
+  dispatch(GameInput::PLAYER_CARD, card.playerId);
+  flushTap_ = tap;
+  flushType_ = NfcCardType::PLAYER;
+  flushId_ = card.playerId;
+}
+
+void GameLogic::onPropertyCard(const CardTap &tap, CardManager &cards) {
+  PropertyCardData card{};
+  if (!cards.readProperty(tap, card)) {
     return;
   }
-  if (state_ == UiState::AUCTION && !ctx_.auctionAwaitWinner) {
-    ctx_.auctionBid += 20;
+
+  PropertyState *prop = propertyById(card.propertyId);
+  if (!prop) return;
+
+  // The card's price is adopted on any screen
+  if (card.basePrice > 0) {
+    setBasePrice(*prop, card.basePrice);
+  }
+  syncProperty(card);
+  dispatch(GameInput::PROPERTY_CARD, prop->id);
+  flushTap_ = tap;
+  flushType_ = NfcCardType::PROPERTY;
+  flushId_ = prop->id;
+}
+
+// =============================================================================
+// CARD SYNC
+// =============================================================================
+void GameLogic::syncPlayer(const PlayerCardData &card) {
+  PlayerState *p = playerById(card.playerId);
+  if (!p) return;
+  const uint8_t i = card.playerId - 1;
+  if (gameId_ != 0 && card.gameId == gameId_ && seqAfter(card.seq, playerSeq_[i])) {
+    setBalance(*p, card.balance);
+    setJailed(*p, card.jailed);
+    setBankrupt(*p, card.bankrupt);
+    playerSeq_[i] = card.seq;
+    dirtyPlayers_ &= ~playerBit(card.playerId);
     touchState();
+  } else if (card.gameId != gameId_ || card.seq != playerSeq_[i]) {
+    dirtyPlayers_ |= playerBit(card.playerId);
   }
 }
 
-void GameLogic::onBtn2() {
-  if (state_ == UiState::WAIT_CARD && ctx_.noCancel) {
-    return;
+// Property changes all start from a tap of the property's own card, so a
+// resumed game has adopted the card before it changes the record.
+void GameLogic::syncProperty(const PropertyCardData &card) {
+  PropertyState *prop = propertyById(card.propertyId);
+  if (!prop) return;
+  const uint8_t i = card.propertyId - 1;
+  if (gameId_ != 0 && card.gameId == gameId_ && seqAfter(card.seq, propertySeq_[i])) {
+    setOwner(*prop, card.ownerId <= GAME_MAX_PLAYERS ? card.ownerId : 0);
+    prop->level = (card.level >= 1 && card.level <= kMaxLevel) ? card.level : 1;
+    propertySeq_[i] = card.seq;
+    dirtyProperties_ &= ~(1UL << i);
+    touchState();
+  } else if (card.gameId != gameId_ || card.seq != propertySeq_[i]) {
+    dirtyProperties_ |= 1UL << i;
   }
-  if (state_ == UiState::WINNER) {
+}
+
+// Runs after the tap's screen is drawn; the reader still holds the card's
+// authentication, so this is one block write.
+bool GameLogic::flushCard(CardManager &cards) {
+  const uint8_t id = flushId_;
+  flushId_ = 0;
+  if (id == 0) return false;
+
+  if (flushType_ == NfcCardType::PLAYER) {
+    if (!(dirtyPlayers_ & playerBit(id))) return false;
+    const PlayerState &p = players_[id - 1];
+    PlayerCardData card{};
+    card.playerId = id;
+    card.balance = p.balance;
+    card.jailed = p.jailed;
+    card.bankrupt = p.bankrupt;
+    card.seq = playerSeq_[id - 1];
+    card.gameId = gameId_;
+    if (!cards.writePlayer(flushTap_, card)) return false;
+    dirtyPlayers_ &= ~playerBit(id);
+    return true;
+  }
+
+  if (!(dirtyProperties_ & (1UL << (id - 1)))) return false;
+  const PropertyState &prop = properties_[id - 1];
+  PropertyCardData card{};
+  card.propertyId = id;
+  card.ownerId = prop.ownerId;
+  card.level = prop.level;
+  card.basePrice = prop.basePrice;
+  card.seq = propertySeq_[id - 1];
+  card.gameId = gameId_;
+  if (!cards.writeProperty(flushTap_, card)) return false;
+  dirtyProperties_ &= ~(1UL << (id - 1));
+  return true;
+}
+
+void GameLogic::onEventCard(const CardTap &tap, CardManager &cards) {
+  // Skip the card read when nothing would use it
+  if (!handles(GameInput::EVENT_CARD)) return;
+
+  EventCardData card{};
+  if (!cards.readEvent(tap, card)) {
     return;
   }
+  dispatch(GameInput::EVENT_CARD, card.eventId);
+}
+
+// =============================================================================
+// HANDLERS
+// =============================================================================
+void GameLogic::ignore(uint8_t) {}
+
+void GameLogic::goHome(uint8_t) {
   ctx_ = {};
   setState(UiState::HOME);
 }
 
-void GameLogic::onBtn3() {
-  if (state_ == UiState::HOME) {
-    ctx_ = {};
-    setState(UiState::JAIL);
-    return;
-  }
-  if (state_ == UiState::PROPERTY_UNOWNED) {
-    startAuction(ctx_.propertyId);
-  }
+void GameLogic::cancelWait(uint8_t arg) {
+  if (ctx_.noCancel) return;
+  goHome(arg);
 }
 
-void GameLogic::triggerMenuAction(uint8_t action) {
-  if (state_ != UiState::HOME) {
-    return;
-  }
+void GameLogic::openGo(uint8_t) {
+  ctx_ = {};
+  setState(UiState::GO);
+}
+
+void GameLogic::openJail(uint8_t) {
+  ctx_ = {};
+  setState(UiState::JAIL);
+}
+
+void GameLogic::menuAction(uint8_t action) {
   ctx_ = {};
   if (action == 0) {
     setState(UiState::GO);
@@ -323,206 +641,202 @@ void GameLogic::triggerMenuAction(uint8_t action) {
   }
 }
 
-void GameLogic::onTick() {
-  const uint32_t now = millis();
-
-  if (state_ == UiState::WAIT_CARD || state_ == UiState::GO || state_ == UiState::TRAIN || state_ == UiState::JAIL) {
-    if (now - stateSinceMs_ > WAIT_TIMEOUT_MS) {
-      ctx_ = {};
-      setFlash(ctx_, "TIMEOUT");
-      setState(UiState::HOME);
-      return;
-    }
-  }
-
-  if (state_ == UiState::EVENT) {
-    if (now - stateSinceMs_ > 800) {
-      ctx_.waitReason = WaitReason::EVENT_TARGET;
-      ctx_.noCancel = true;
-      setState(UiState::WAIT_CARD);
-    }
-    return;
-  }
+void GameLogic::waitBuyer(uint8_t) {
+  ctx_.waitReason = WaitReason::BUY_PLAYER;
+  ctx_.noCancel = false;
+  setState(UiState::WAIT_CARD);
+}
 
-  if (state_ == UiState::AUCTION && !ctx_.auctionAwaitWinner) {
-    if (now - lastAuctionTickMs_ >= 1000) {
-      lastAuctionTickMs_ = now;
-      if (ctx_.auctionSecondsLeft > 0) {
-        ctx_.auctionSecondsLeft--;
-        touchState();
-      }
-      if (ctx_.auctionSecondsLeft <= 0) {
-        ctx_.auctionAwaitWinner = true;
-        touchState();
-      }
-    }
-  }
+void GameLogic::waitRentPayer(uint8_t) {
+  ctx_.waitReason = WaitReason::RENT_PAYER;
+  ctx_.noCancel = false;
+  setState(UiState::WAIT_CARD);
 }
 
-void GameLogic::onPlayerCard(const CardTap &tap, CardManager &cards) {
-  PlayerCardData card{};
-  if (!cards.readPlayer(tap, card)) {
-    return;
-  }
+void GameLogic::startPropertyAuction(uint8_t) {
+  startAuction(ctx_.propertyId);
+}
 
-  ensurePlayer(card.playerId);
-  PlayerState *player = playerById(card.playerId);
-  if (!player) return;
+void GameLogic::raiseBid(uint8_t) {
+  if (ctx_.auctionAwaitWinner) return;
+  ctx_.auctionBid += 20;
+  touchState();
+}
 
-  if (state_ == UiState::GO) {
-    player->balance += 200;
-    ctx_ = {};
-    setFlash(ctx_, "+200");
-    setState(UiState::HOME);
-    return;
-  }
+void GameLogic::tickTimeout(uint8_t) {
+  ctx_ = {};
+  setFlash(ctx_, "TIMEOUT");
+  setState(UiState::HOME);
+}
 
-  if (state_ == UiState::JAIL) {
-    if (player->balance >= 100) {
-      player->balance -= 100;
-      player->jailed = false;
-      ctx_ = {};
-      setFlash(ctx_, "JAIL -100");
-      setState(UiState::HOME);
-    } else {
-      const int32_t left = 100 - player->balance;
-      player->balance = 0;
-      enterDebt(player->id, 0, left);
-    }
-    return;
-  }
+void GameLogic::tickEvent(uint8_t) {
+  ctx_.waitReason = WaitReason::EVENT_TARGET;
+  ctx_.noCancel = true;
+  setState(UiState::WAIT_CARD);
+}
 
-  if (state_ == UiState::TRAIN) {
-    if (player->balance >= 100) {
-      player->balance -= 100;
-      ctx_ = {};
-      setFlash(ctx_, "TRAIN -100");
-      setState(UiState::HOME);
-    } else {
-      const int32_t left = 100 - player->balance;
-      player->balance = 0;
-      enterDebt(player->id, 0, left);
-    }
-    return;
+// One auction second per timer; the last one waits for the winner's card
+void GameLogic::tickAuction(uint8_t) {
+  if (ctx_.auctionAwaitWinner) return;
+  if (ctx_.auctionSecondsLeft > 0) {
+    ctx_.auctionSecondsLeft--;
+    touchState();
   }
-
-  if (state_ == UiState::WAIT_CARD && ctx_.waitReason == WaitReason::BUY_PLAYER) {
-    PropertyState *prop = propertyById(ctx_.propertyId);
-    if (!prop) return;
-    const int32_t price = prop->basePrice;
-    if (player->balance >= price) {
-      player->balance -= price;
-      prop->ownerId = player->id;
-      prop->level = 1;
-      markPropertyDirty(prop->id);
-      ctx_ = {};
-      setFlash(ctx_, "PURCHASE");
-      setState(UiState::HOME);
-    } else {
-      const int32_t left = price - player->balance;
-      player->balance = 0;
-      enterDebt(player->id, 0, left);
-    }
-    return;
+  if (ctx_.auctionSecondsLeft <= 0) {
+    ctx_.auctionAwaitWinner = true;
+    touchState();
+  } else {
+    armState(kAuctionStepMs);
   }
+}
 
-  if (state_ == UiState::WAIT_CARD && ctx_.waitReason == WaitReason::RENT_PAYER) {
-    PropertyState *prop = propertyById(ctx_.propertyId);
-    if (!prop || prop->ownerId == 0) return;
+void GameLogic::flashCard(uint8_t) {
+  ctx_ = {};
+  setFlash(ctx_, "CARD");
+  touchState();
+}
 
-    if (player->id == prop->ownerId) {
-      if (prop->level < kMaxLevel) prop->level++;
-      markPropertyDirty(prop->id);
-      ctx_ = {};
-      setFlash(ctx_, "LEVEL UP");
-      setState(UiState::HOME);
-      return;
-    }
+void GameLogic::collectGo(uint8_t playerId) {
+  PlayerState *player = playerById(playerId);
+  if (!player) return;
+  adjustBalance(*player, 200);
+  ctx_ = {};
+  setFlash(ctx_, "+200");
+  setState(UiState::HOME);
+}
 
-    const int32_t rent = propertyRent(prop->id, prop->level);
-    PlayerState *owner = playerById(prop->ownerId);
-    if (!owner) return;
+void GameLogic::payJail(uint8_t playerId) {
+  PlayerState *player = playerById(playerId);
+  if (!player) return;
+  if (player->balance >= 100) setJailed(*player, false);
+  payFine(*player, "JAIL -100");
+}
 
-    if (player->balance >= rent) {
-      player->balance -= rent;
-      owner->balance += rent;
-      if (prop->level < kMaxLevel) prop->level++;
-      markPropertyDirty(prop->id);
-      ctx_ = {};
-      setFlash(ctx_, "RENT PAID");
-      setState(UiState::HOME);
-    } else {
-      owner->balance += player->balance;
-      const int32_t left = rent - player->balance;
-      player->balance = 0;
-      enterDebt(player->id, owner->id, left);
-    }
-    return;
-  }
+void GameLogic::payTrain(uint8_t playerId) {
+  PlayerState *player = playerById(playerId);
+  if (!player) return;
+  payFine(*player, "TRAIN -100");
+}
 
-  if (state_ == UiState::WAIT_CARD && ctx_.waitReason == WaitReason::EVENT_TARGET) {
-    EventCardData event = kDefaultEvents[0];
-    for (const auto &e : kDefaultEvents) {
-      if (e.eventId == ctx_.eventId) {
-        event = e;
-        break;
-      }
-    }
-    applyEventToPlayer(event, player->id);
-    return;
+void GameLogic::payFine(PlayerState &player, const char *flash) {
+  if (player.balance >= 100) {
+    adjustBalance(player, -100);
+    ctx_ = {};
+    setFlash(ctx_, flash);
+    setState(UiState::HOME);
+  } else {
+    const int32_t left = 100 - player.balance;
+    setBalance(player, 0);
+    enterDebt(player.id, 0, left);
   }
+}
 
-  if (state_ == UiState::AUCTION && ctx_.auctionAwaitWinner) {
-    PropertyState *prop = propertyById(ctx_.propertyId);
-    if (!prop) return;
-    const int32_t bid = ctx_.auctionBid;
-    if (player->balance >= bid) {
-      player->balance -= bid;
-      prop->ownerId = player->id;
-      prop->level = 1;
-      markPropertyDirty(prop->id);
-      ctx_ = {};
-      setFlash(ctx_, "AUCTION OK");
-      setState(UiState::HOME);
-    } else {
-      const int32_t left = bid - player->balance;
-      player->balance = 0;
-      enterDebt(player->id, 0, left);
-    }
-    return;
-  }
+// WAIT_CARD serves three screens; the reason picks the handler.
+void GameLogic::waitCardPlayer(uint8_t playerId) {
+  static constexpr Handler kByReason[] = {
+      &GameLogic::ignore,       // NONE
+      &GameLogic::buyProperty,  // BUY_PLAYER
+      &GameLogic::payRent,      // RENT_PAYER
+      &GameLogic::eventTarget,  // EVENT_TARGET
+  };
+  static_assert(sizeof(kByReason) / sizeof(kByReason[0]) == static_cast<uint8_t>(WaitReason::EVENT_TARGET) + 1,
+                "one handler per WaitReason");
+  (this->*kByReason[static_cast<uint8_t>(ctx_.waitReason)])(playerId);
+}
 
-  if (state_ == UiState::HOME) {
+void GameLogic::buyProperty(uint8_t playerId) {
+  PlayerState *player = playerById(playerId);
+  PropertyState *prop = propertyById(ctx_.propertyId);
+  if (!player || !prop) return;
+  stats_.onLanding(player->id, prop->id);
+  const int32_t price = prop->basePrice;
+  if (player->balance >= price) {
+    adjustBalance(*player, -price);
+    setOwner(*prop, player->id);
+    prop->level = 1;
+    markPropertyDirty(prop->id);
     ctx_ = {};
-    setFlash(ctx_, "CARD");
-    touchState();
+    setFlash(ctx_, "PURCHASE");
+    setState(UiState::HOME);
+  } else {
+    const int32_t left = price - player->balance;
+    setBalance(*player, 0);
+    enterDebt(player->id, 0, left);
   }
 }
 
-void GameLogic::onPropertyCard(const CardTap &tap, CardManager &cards) {
-  (void)cards;
-  PropertyCardData card{};
-  if (!cards.readProperty(tap, card)) {
+void GameLogic::payRent(uint8_t playerId) {
+  PlayerState *player = playerById(playerId);
+  PropertyState *prop = propertyById(ctx_.propertyId);
+  if (!player || !prop || prop->ownerId == 0) return;
+  stats_.onLanding(player->id, prop->id);
+
+  if (player->id == prop->ownerId) {
+    if (prop->level < kMaxLevel) prop->level++;
+    markPropertyDirty(prop->id);
+    ctx_ = {};
+    setFlash(ctx_, "LEVEL UP");
+    setState(UiState::HOME);
     return;
   }
 
-  PropertyState *prop = propertyById(card.propertyId);
-  if (!prop) return;
+  const int32_t rent = propertyRent(prop->id, prop->level);
+  PlayerState *owner = playerById(prop->ownerId);
+  if (!owner) return;
 
-  if (card.basePrice > 0) {
-    prop->basePrice = card.basePrice;
-    prop->baseRent = card.basePrice;
+  if (player->balance >= rent) {
+    stats_.onRent(player->id, owner->id, prop->id, rent);
+    adjustBalance(*player, -rent);
+    adjustBalance(*owner, rent);
+    if (prop->level < kMaxLevel) prop->level++;
+    markPropertyDirty(prop->id);
+    ctx_ = {};
+    setFlash(ctx_, "RENT PAID");
+    setState(UiState::HOME);
+  } else {
+    stats_.onRent(player->id, owner->id, prop->id, player->balance);
+    adjustBalance(*owner, player->balance);
+    const int32_t left = rent - player->balance;
+    setBalance(*player, 0);
+    enterDebt(player->id, owner->id, left);
   }
+}
 
-  if (state_ == UiState::DEBT) {
-    settleDebtWithProperty(prop->id);
-    return;
+void GameLogic::eventTarget(uint8_t playerId) {
+  EventCardData event = kDefaultEvents[0];
+  for (const auto &e : kDefaultEvents) {
+    if (e.eventId == ctx_.eventId) {
+      event = e;
+      break;
+    }
   }
+  applyEventToPlayer(event, playerId);
+}
 
-  if (state_ != UiState::HOME && state_ != UiState::WAIT_CARD) {
-    return;
+void GameLogic::auctionWinner(uint8_t playerId) {
+  if (!ctx_.auctionAwaitWinner) return;
+  PlayerState *player = playerById(playerId);
+  PropertyState *prop = propertyById(ctx_.propertyId);
+  if (!player || !prop) return;
+  const int32_t bid = ctx_.auctionBid;
+  if (player->balance >= bid) {
+    adjustBalance(*player, -bid);
+    setOwner(*prop, player->id);
+    prop->level = 1;
+    markPropertyDirty(prop->id);
+    ctx_ = {};
+    setFlash(ctx_, "AUCTION OK");
+    setState(UiState::HOME);
+  } else {
+    const int32_t left = bid - player->balance;
+    setBalance(*player, 0);
+    enterDebt(player->id, 0, left);
   }
+}
 
+void GameLogic::showProperty(uint8_t propertyId) {
+  PropertyState *prop = propertyById(propertyId);
+  if (!prop) return;
   ctx_ = {};
   ctx_.propertyId = prop->id;
   if (prop->ownerId == 0) {
@@ -532,15 +846,12 @@ void GameLogic::onPropertyCard(const CardTap &tap, CardManager &cards) {
   }
 }
 
-void GameLogic::onEventCard(const CardTap &tap, CardManager &cards) {
-  if (state_ != UiState::HOME) return;
-
-  EventCardData card{};
-  if (!cards.readEvent(tap, card)) {
-    return;
-  }
+void GameLogic::settleDebt(uint8_t propertyId) {
+  settleDebtWithProperty(propertyId);
+}
 
+void GameLogic::showEvent(uint8_t eventId) {
   ctx_ = {};
-  ctx_.eventId = card.eventId;
+  ctx_.eventId = eventId;
   setState(UiState::EVENT);
 }
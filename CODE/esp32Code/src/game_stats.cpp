@@ -0,0 +1,118 @@
+#include "game_stats.h"
+
+#include <string.h>
+
+namespace {
+// Streams bytes to a Print while keeping a CRC16-CCITT of everything written.
+struct Writer {
+  Print &out;
+  uint16_t crc = 0xFFFF;
+  size_t n = 0;
+
+  explicit Writer(Print &p) : out(p) {}
+
+  void byte(uint8_t b) {
+    out.write(b);
+    n++;
+    crc ^= static_cast<uint16_t>(b) << 8;
+    for (uint8_t i = 0; i < 8; i++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  void var(uint32_t v) {
+    while (v >= 0x80) {
+      byte(static_cast<uint8_t>(v | 0x80));
+      v >>= 7;
+    }
+    byte(static_cast<uint8_t>(v));
+  }
+  void zig(int32_t v) { var((static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31)); }
+};
+}  // namespace
+
+void GameStats::reset() {
+  *this = GameStats{};
+  actionStartMs_ = millis();
+}
+
+void GameStats::onLanding(uint8_t playerId, uint8_t propertyId) {
+  if (playerId < 1 || playerId > GAME_MAX_PLAYERS) return;
+  if (propertyId < 1 || propertyId > PROPERTY_COUNT) return;
+  uint16_t &n = landings_[playerId - 1][propertyId - 1];
+  if (n < UINT16_MAX) n++;
+}
+
+void GameStats::onRent(uint8_t fromId, uint8_t toId, uint8_t propertyId, int32_t amount) {
+  if (amount <= 0) return;
+  if (propertyId >= 1 && propertyId <= PROPERTY_COUNT) rentByProperty_[propertyId - 1] += amount;
+  if (fromId >= 1 && fromId <= GAME_MAX_PLAYERS) rentPaid_[fromId - 1] += amount;
+  if (toId >= 1 && toId <= GAME_MAX_PLAYERS) rentCollected_[toId - 1] += amount;
+}
+
+void GameStats::onActionStart() {
+  actionStartMs_ = millis();
+}
+
+void GameStats::onActionEnd(const PlayerState *players) {
+  const uint32_t dt = millis() - actionStartMs_;
+  if (actions_ < UINT16_MAX) actions_++;
+  actionTotalMs_ += dt;
+  if (dt > actionMaxMs_) actionMaxMs_ = dt;
+  uint8_t b = 0;
+  for (uint32_t lim = 2000; dt >= lim && b < TIME_BUCKETS - 1; lim <<= 1) b++;
+  actionHist_[b]++;
+
+  if (++cashPhase_ < cashStride_) return;
+  cashPhase_ = 0;
+  if (cashCount_ == CASH_SAMPLES) {
+    // Keep every other sample and halve the rate
+    for (uint8_t p = 0; p < GAME_MAX_PLAYERS; p++) {
+      for (uint8_t i = 0; i < CASH_SAMPLES / 2; i++) cash_[p][i] = cash_[p][i * 2];
+    }
+    cashCount_ = CASH_SAMPLES / 2;
+    cashStride_ *= 2;
+  }
+  for (uint8_t p = 0; p < GAME_MAX_PLAYERS; p++) cash_[p][cashCount_] = players[p].balance;
+  cashCount_++;
+}
+
+uint8_t GameStats::topRentProperty() const {
+  uint8_t best = 0;
+  for (uint8_t i = 0; i < PROPERTY_COUNT; i++) {
+    if (rentByProperty_[i] == 0) continue;
+    if (best == 0 || rentByProperty_[i] > rentByProperty_[best - 1]) best = i + 1;
+  }
+  return best;
+}
+
+uint32_t GameStats::rentByProperty(uint8_t propertyId) const {
+  if (propertyId < 1 || propertyId > PROPERTY_COUNT) return 0;
+  return rentByProperty_[propertyId - 1];
+}
+
+// Body: players props cashCount cashStride actions totalMs maxMs hist[8]
+//       per player: landings[props] rentPaid rentCollected cash[cashCount]
+//       rentByProperty[props]
+size_t GameStats::exportTo(Print &out) const {
+  out.write(reinterpret_cast<const uint8_t *>("MSE\x01"), 4);
+
+  Writer w(out);
+  w.var(GAME_MAX_PLAYERS);
+  w.var(PROPERTY_COUNT);
+  w.var(cashCount_);
+  w.var(cashStride_);
+  w.var(actions_);
+  w.var(actionTotalMs_);
+  w.var(actionMaxMs_);
+  for (uint8_t b = 0; b < TIME_BUCKETS; b++) w.var(actionHist_[b]);
+
+  for (uint8_t p = 0; p < GAME_MAX_PLAYERS; p++) {
+    for (uint8_t i = 0; i < PROPERTY_COUNT; i++) w.var(landings_[p][i]);
+    w.var(rentPaid_[p]);
+    w.var(rentCollected_[p]);
+    for (uint8_t i = 0; i < cashCount_; i++) w.zig(cash_[p][i]);
+  }
+  for (uint8_t i = 0; i < PROPERTY_COUNT; i++) w.var(rentByProperty_[i]);
+
+  out.write(static_cast<uint8_t>(w.crc & 0xFF));
+  out.write(static_cast<uint8_t>(w.crc >> 8));
+  return 4 + w.n + 2;
+}
@@ -0,0 +1,28 @@
+#include "glyph_atlas.h"
+
+#include <Adafruit_GFX.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool GlyphAtlas::begin() {
+  if (ready()) return true;
+  for (uint8_t s = 1; s <= MAX_SIZE; s++) {
+    const uint16_t bytes = glyphBytes(s);
+    uint8_t *bits = static_cast<uint8_t *>(malloc(static_cast<size_t>(bytes) * (LAST - FIRST + 1)));
+    if (!bits) return false;
+
+    // Let GFX draw each character once and keep its 1-bit raster
+    GFXcanvas1 cell(6 * s, 8 * s);
+    if (!cell.getBuffer()) {
+      free(bits);
+      return false;
+    }
+    for (uint16_t c = FIRST; c <= LAST; c++) {
+      cell.fillScreen(0);
+      cell.drawChar(0, 0, static_cast<unsigned char>(c), 1, 0, s);
+      memcpy(bits + (c - FIRST) * bytes, cell.getBuffer(), bytes);
+    }
+    bits_[s - 1] = bits;
+  }
+  return true;
+}
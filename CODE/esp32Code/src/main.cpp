@@ -1,16 +1,20 @@
 #include <Arduino.h>
+#include <Preferences.h>
 
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "battery_manager.h"
+#include "boot_trace.h"
 #include "card_manager.h"
 #include "config.h"
 #include "display_ui.h"
 #include "game_logic.h"
 #include "nfc_manager.h"
+#include "power_manager.h"
 #include "sound_manager.h"
+#include "timer_wheel.h"
 
 namespace {
 NfcManager nfc;
@@ -19,9 +23,14 @@ GameLogic game;
 DisplayUi ui;
 BatteryManager battery;
 SoundManager sound;
+PowerManager power;
+BootTrace boot;
+TimerWheel timers;  // loop core only
+
+volatile bool nfcOk = false;
+bool nfcBootHandled = false;
 
 uint32_t lastRenderMs = 0;
-UiState lastState = UiState::HOME;
 
 struct ButtonInput {
   int pin = -1;
@@ -29,6 +38,7 @@ struct ButtonInput {
   bool rawPressed = false;
   uint32_t lastDebounceMs = 0;
   uint32_t pressStartMs = 0;
+  bool swallow = false;  // this press lit a dark screen: its release does nothing
 };
 
 ButtonInput btn1;
@@ -48,15 +58,17 @@ ProgramCategory programCategory = ProgramCategory::Player;
 uint8_t programIndex = 0;
 char programDetail[40] = {0};
 char programMessage[40] = {0};
-uint32_t programMessageUntilMs = 0;
+TimerWheel::Id programMessageTimer = TimerWheel::NONE;
 uint32_t comboHoldStartMs = 0;
 bool comboLatch = false;
 bool uiDirty = true;
-int8_t lastWaitAnimPhase = -1;
 
 AppMode appMode = AppMode::LobbyRegister;
-bool activeLobbyPlayers[GAME_MAX_PLAYERS] = {false};
-bool fundedLobbyPlayers[GAME_MAX_PLAYERS] = {false};
+PlayerMask activeLobbyPlayers = 0;
+PlayerMask fundedLobbyPlayers = 0;
+PlayerMask resumeLobbyPlayers = 0;  // cards carrying savedGameId
+PlayerCardData lobbyCards[GAME_MAX_PLAYERS];
+uint8_t savedGameId = 0;            // last started game, kept across resets
 uint8_t registeredCount = 0;
 uint8_t requiredPlayerCount = 0;
 char lobbyMessage[40] = {0};
@@ -79,6 +91,29 @@ void logf(const char *fmt, ...) {
   Serial0.println(buf);
 }
 
+// Game ids tell this game's cards from leftovers of earlier ones
+void loadGameId() {
+  Preferences prefs;
+  prefs.begin("monopoly", true);
+  savedGameId = prefs.getUChar("game", 0);
+  prefs.end();
+}
+
+void startNewGameId() {
+  if (++savedGameId == 0) savedGameId = 1;
+  Preferences prefs;
+  prefs.begin("monopoly", false);
+  prefs.putUChar("game", savedGameId);
+  prefs.end();
+}
+
+// Queued balance / ownership write-back to the card just handled, after its
+// screen is up so the tap's latency is unchanged
+void flushCards() {
+  if (!cards || !game.flushCard(*cards)) return;
+  DBG("[SYNC] card written, %u queued", game.queuedWrites());
+}
+
 void setLobbyMessage(const char *msg) {
   strncpy(lobbyMessage, msg, sizeof(lobbyMessage) - 1);
   lobbyMessage[sizeof(lobbyMessage) - 1] = '\0';
@@ -86,48 +121,30 @@ void setLobbyMessage(const char *msg) {
 }
 
 void clearLobbyData() {
-  for (uint8_t i = 0; i < GAME_MAX_PLAYERS; i++) {
-    activeLobbyPlayers[i] = false;
-    fundedLobbyPlayers[i] = false;
-  }
+  activeLobbyPlayers = 0;
+  fundedLobbyPlayers = 0;
+  resumeLobbyPlayers = 0;
   registeredCount = 0;
   requiredPlayerCount = 0;
   setLobbyMessage(TXT("tap player cards", "toca cartas de jugador"));
 }
 
-const char *stateName(UiState state) {
-  switch (state) {
-    case UiState::HOME:
-      return "HOME";
-    case UiState::WAIT_CARD:
-      return "WAIT_CARD";
-    case UiState::PROPERTY_UNOWNED:
-      return "PROPERTY_UNOWNED";
-    case UiState::PROPERTY_OWNED:
-      return "PROPERTY_OWNED";
-    case UiState::EVENT:
-      return "EVENT";
-    case UiState::AUCTION:
-      return "AUCTION";
-    case UiState::DEBT:
-      return "DEBT";
-    case UiState::GO:
-      return "GO";
-    case UiState::TRAIN:
-      return "TRAIN";
-    case UiState::JAIL:
-      return "JAIL";
-    case UiState::WINNER:
-      return "WINNER";
+// GameLogic calls this after every handled input
+void onTransition(UiState from, UiState to, GameInput input, uint32_t us) {
+  if (from == to) {
+    DBG("[STATE] %s (%s) %lu us", uiStateName(to), gameInputName(input), static_cast<unsigned long>(us));
+    return;
+  }
+  logf("[STATE] %s -> %s (%s) %lu us", uiStateName(from), uiStateName(to), gameInputName(input),
+       static_cast<unsigned long>(us));
+  DBG("anim frames %lu draws %lu missed %lu deferred %lu, max %lu us",
+      static_cast<unsigned long>(ui.animStats().frames), static_cast<unsigned long>(ui.animStats().draws),
+      static_cast<unsigned long>(ui.animStats().missed), static_cast<unsigned long>(ui.animStats().deferred),
+      static_cast<unsigned long>(ui.animStats().maxFrameUs));
+  if (to == UiState::WINNER) {
+    const size_t bytes = game.stats().exportTo(Serial);
+    logf("[STATS] exported %u bytes", static_cast<unsigned>(bytes));
   }
-  return "UNKNOWN";
-}
-
-void logStateTransition(const char *reason) {
-  const UiState now = game.state();
-  if (now == lastState) return;
-  logf("[STATE] %s -> %s (%s)", stateName(lastState), stateName(now), reason);
-  lastState = now;
 }
 
 void printUid(const CardTap &tap) {
@@ -162,10 +179,15 @@ ButtonPress pollButton(ButtonInput &btn) {
       btn.pressStartMs = now;
       return ButtonPress::None;
     }
+    if (btn.swallow) {
+      btn.swallow = false;
+      return ButtonPress::None;
+    }
     const uint32_t heldMs = now - btn.pressStartMs;
     return heldMs >= LONG_PRESS_MS ? ButtonPress::Long : ButtonPress::Short;
   }
 
+  if (!btn.stablePressed) btn.swallow = false;  // the wake edge was a glitch
   return ButtonPress::None;
 }
 
@@ -191,10 +213,16 @@ uint8_t maxIndexForCategory(ProgramCategory cat) {
   return 5;
 }
 
+void clearProgramMessage(void *) {
+  programMessage[0] = '\0';
+  uiDirty = true;
+}
+
 void setProgramMessage(const char *msg, uint32_t holdMs = 1000) {
   strncpy(programMessage, msg, sizeof(programMessage) - 1);
   programMessage[sizeof(programMessage) - 1] = '\0';
-  programMessageUntilMs = millis() + holdMs;
+  timers.cancel(programMessageTimer);
+  programMessageTimer = timers.start(holdMs, clearProgramMessage, nullptr);
   uiDirty = true;
 }
 
@@ -240,7 +268,17 @@ void moveItem(int dir) {
   updateProgramDetail();
 }
 
+// The press that wakes a dark screen only turns it on
+void swallowWakePress() {
+  if (!power.takeDarkWake()) return;
+  ButtonInput *const buttons[] = {&btn1, &btn2, &btn3};
+  for (ButtonInput *btn : buttons) {
+    if (digitalRead(btn->pin) == LOW || btn->rawPressed) btn->swallow = true;
+  }
+}
+
 void handleButtons() {
+  swallowWakePress();
   const ButtonPress b1 = pollButton(btn1);
   const ButtonPress b2 = pollButton(btn2);
   const ButtonPress b3 = pollButton(btn3);
@@ -285,14 +323,20 @@ void handleButtons() {
     if (b3 == ButtonPress::Short) {
       if (registeredCount >= 2) {
         requiredPlayerCount = registeredCount;
-        for (uint8_t i = 0; i < GAME_MAX_PLAYERS; i++) {
-          if (!activeLobbyPlayers[i]) continue;
-          fundedLobbyPlayers[i] = true;
-          game.primePlayer(i + 1, STARTING_MONEY);
+        fundedLobbyPlayers = activeLobbyPlayers;
+        const bool resume = resumeLobbyPlayers != 0;
+        if (!resume) startNewGameId();
+        game.setGameId(savedGameId);
+        for (uint8_t id = 1; id <= GAME_MAX_PLAYERS; id++) {
+          if (resumeLobbyPlayers & playerBit(id)) {
+            game.restorePlayer(lobbyCards[id - 1]);
+          } else if (activeLobbyPlayers & playerBit(id)) {
+            game.primePlayer(id, STARTING_MONEY);
+          }
         }
         appMode = AppMode::Running;
         setLobbyMessage(TXT("players funded, game start", "jugadores con saldo, inicia juego"));
-        logf("[LOBBY] game start with %u players", requiredPlayerCount);
+        logf("[LOBBY] game %u %s with %u players", savedGameId, resume ? "resumed" : "start", requiredPlayerCount);
         sound.beepOk();
       } else {
         setLobbyMessage(TXT("need at least 2 players", "se necesitan al menos 2 jugadores"));
@@ -323,7 +367,6 @@ void handleButtons() {
       uiDirty = true;
       sound.beepOk();
       logf("[MENU] selected option=%u", actionMenuIndex);
-      logStateTransition("MENU_SELECT");
     }
     return;
   }
@@ -332,7 +375,6 @@ void handleButtons() {
     logLine("[BTN] X pressed");
     game.onBtn2();
     sound.beepTick();
-    logStateTransition("X");
   }
   if (b2 == ButtonPress::Short) {
     if (game.state() == UiState::HOME) {
@@ -345,14 +387,12 @@ void handleButtons() {
       logLine("[BTN] M pressed");
       game.onBtn3();
       sound.beepTick();
-      logStateTransition("M");
     }
   }
   if (b3 == ButtonPress::Short) {
     logLine("[BTN] CHECK pressed");
     game.onBtn1();
     sound.beepTick();
-    logStateTransition("CHECK");
   }
 }
 
@@ -397,6 +437,7 @@ void handleProgramCombo() {
 void handleCardTap() {
   CardTap tap{};
   if (!nfc.poll(tap)) return;
+  power.activity();
 
   if (programmingMode) {
     if (!programArmed) {
@@ -475,12 +516,18 @@ void handleCardTap() {
       sound.beepError();
       return;
     }
-    const uint8_t idx = player.playerId - 1;
-    if (!activeLobbyPlayers[idx]) {
-      activeLobbyPlayers[idx] = true;
+    if (!(activeLobbyPlayers & playerBit(player.playerId))) {
+      activeLobbyPlayers |= playerBit(player.playerId);
       registeredCount++;
       logf("[LOBBY] registered player=%u total=%u", player.playerId, registeredCount);
     }
+    // A card from the interrupted game brings its balance back
+    lobbyCards[player.playerId - 1] = player;
+    if (savedGameId != 0 && player.gameId == savedGameId) {
+      resumeLobbyPlayers |= playerBit(player.playerId);
+    } else {
+      resumeLobbyPlayers &= ~playerBit(player.playerId);
+    }
     setLobbyMessage(TXT("player registered", "jugador registrado"));
     uiDirty = true;
     sound.beepOk();
@@ -492,7 +539,7 @@ void handleCardTap() {
     PlayerCardData player{};
     if (cards->readPlayer(tap, player)) {
       if (appMode == AppMode::Running) {
-        if (player.playerId < 1 || player.playerId > GAME_MAX_PLAYERS || !activeLobbyPlayers[player.playerId - 1]) {
+        if (player.playerId < 1 || player.playerId > GAME_MAX_PLAYERS || !(activeLobbyPlayers & playerBit(player.playerId))) {
           setLobbyMessage(TXT("player not in this game", "jugador fuera de esta partida"));
           uiDirty = true;
           sound.beepError();
@@ -512,7 +559,6 @@ void handleCardTap() {
     }
     game.onPlayerCard(tap, *cards);
     sound.beepOk();
-    logStateTransition("PLAYER_CARD");
     return;
   }
   if (type == NfcCardType::PROPERTY) {
@@ -531,7 +577,6 @@ void handleCardTap() {
     }
     game.onPropertyCard(tap, *cards);
     sound.beepOk();
-    logStateTransition("PROPERTY_CARD");
     return;
   }
   if (type == NfcCardType::EVENT) {
@@ -550,7 +595,6 @@ void handleCardTap() {
     }
     game.onEventCard(tap, *cards);
     sound.beepOk();
-    logStateTransition("EVENT_CARD");
     return;
   }
 
@@ -564,28 +608,12 @@ void handleCardTap() {
 
 void refreshUi(bool force = false) {
   const uint32_t now = millis();
-  if (programMessageUntilMs > 0 && now >= programMessageUntilMs) {
-    programMessage[0] = '\0';
-    programMessageUntilMs = 0;
-    uiDirty = true;
-  }
-
-  bool animDirty = false;
-  const bool waitAnim = (!programmingMode && appMode == AppMode::Running && !actionMenuOpen && game.state() == UiState::WAIT_CARD);
-  if (waitAnim) {
-    const int8_t phase = static_cast<int8_t>((now / 120) % 2);
-    if (phase != lastWaitAnimPhase) {
-      lastWaitAnimPhase = phase;
-      animDirty = true;
-    }
-  } else {
-    lastWaitAnimPhase = -1;
-  }
-
   const bool gameDirty = (!programmingMode && appMode == AppMode::Running && !actionMenuOpen && game.isDirty());
-  const bool needsRender = force || uiDirty || gameDirty || animDirty;
+  const bool needsRender = force || uiDirty || gameDirty;
 
   if (!needsRender) {
+    // Screens animate themselves, within a slice of the loop
+    ui.animate(now, ANIM_BUDGET_US);
     return;
   }
 
@@ -599,18 +627,69 @@ void refreshUi(bool force = false) {
     ui.render(game, battery.readPercent());
     game.clearDirty();
   }
+  DBG("render %lu px, %lu B, %lu windows, text %lu chars %lu us", static_cast<unsigned long>(ui.lastRender().pixels),
+      static_cast<unsigned long>(ui.lastRender().bytes), static_cast<unsigned long>(ui.lastRender().windows),
+      static_cast<unsigned long>(ui.lastText().chars), static_cast<unsigned long>(ui.lastText().micros));
 
   uiDirty = false;
   lastRenderMs = now;
+  power.rendered();
+}
+
+// PN532 bring-up can stall on a missing reader; it runs on the boot task and
+// poll() ignores the reader until it is ready.
+void bootNfc(void *) { nfcOk = nfc.begin(); }
+
+// A button that is down or still settling is sampled every LOOP_IDLE_MS
+bool buttonBusy(const ButtonInput &btn, uint32_t now) {
+  return btn.rawPressed || btn.stablePressed || (now - btn.lastDebounceMs) < BTN_DEBOUNCE_MS;
+}
+
+// Nothing to do until the next deadline or animation frame; button and touch
+// edges end the wait early
+void idle() {
+  const uint32_t now = millis();
+  uint32_t waitMs = timers.msUntilNext(now);
+  const uint32_t animDue = power.screenOn() ? ui.nextAnimDueMs() : UINT32_MAX;
+  if (animDue != UINT32_MAX) {
+    const int32_t animMs = static_cast<int32_t>(animDue - now);
+    if (animMs < static_cast<int32_t>(waitMs)) waitMs = animMs > 0 ? animMs : 0;
+  }
+  const bool sampling = buttonBusy(btn1, now) || buttonBusy(btn2, now) || buttonBusy(btn3, now);
+  if (sampling && waitMs > LOOP_IDLE_MS) waitMs = LOOP_IDLE_MS;
+  // The boot task would stall with the loop core in light sleep
+  power.idle(waitMs, !sampling && boot.done());
+}
+
+#if DEBUG
+void logWake(const PowerStats &p) {
+  DBG("[POWER] wake %lu us to render (max %lu), run %lu / wait %lu / sleep %lu ms, ~%.1f mA",
+      static_cast<unsigned long>(p.wakeUs), static_cast<unsigned long>(p.maxWakeUs),
+      static_cast<unsigned long>(p.runMs), static_cast<unsigned long>(p.waitMs),
+      static_cast<unsigned long>(p.sleepMs), p.avgMa);
+}
+#endif
+
+// First loop pass after the boot task ends: report NFC and the timeline
+void finishBoot() {
+  if (nfcBootHandled || !boot.done()) return;
+  nfcBootHandled = true;
+  logf("[BOOT] nfc init: %s", nfcOk ? "ok" : "failed");
+  if (!nfcOk) {
+    game.onBtn2();
+  }
+  boot.report(logLine);
 }
 }  // namespace
 
 void setup() {
   Serial.begin(115200);
   Serial0.begin(115200);
-  delay(100);
+  boot.mark("serial");
   logLine("[BOOT] booting...");
-  logLine("[BOOT] RAM_MODE: gameplay money/property kept in memory (no gameplay card writes)");
+  logLine("[BOOT] WRITE_BEHIND: money/property written back to each card on its next tap");
+
+  boot.spawn("nfc", bootNfc, nullptr);
 
   pinMode(PIN_BTN1, INPUT_PULLUP);
   pinMode(PIN_BTN2, INPUT_PULLUP);
@@ -620,39 +699,42 @@ void setup() {
   btn2.pin = PIN_BTN2;
   btn3.pin = PIN_BTN3;
 
+  ui.begin();
+  boot.mark("display");
   battery.begin();
-  logLine("[BOOT] battery manager ready");
   sound.begin();
-  logLine("[BOOT] sound manager ready");
-  ui.begin();
-  logLine("[BOOT] display ready");
+  power.begin();
+#if DEBUG
+  power.setHook(logWake);
+#endif
+  boot.mark("battery+sound");
 
-  const bool nfcOk = nfc.begin();
-  logf("[BOOT] nfc init: %s", nfcOk ? "ok" : "failed");
   cards = new CardManager(nfc.driver());
 
-  game.begin();
+  loadGameId();
+  logf("[BOOT] last game id: %u", savedGameId);
+  timers.begin(millis());
+  nfc.attach(timers);
+  game.begin(timers);
   clearLobbyData();
   appMode = AppMode::LobbyRegister;
   updateProgramDetail();
-  lastState = game.state();
-  logf("[BOOT] game state: %s", stateName(lastState));
-  if (!nfcOk) {
-    game.onBtn2();
-    logStateTransition("NFC_FAIL_FALLBACK");
-  }
+  game.setTransitionHook(onTransition);
+  logf("[BOOT] game state: %s", uiStateName(game.state()));
 
   refreshUi(true);
+  boot.mark("lobby");
   logLine("[BOOT] running");
 }
 
 void loop() {
+  finishBoot();
   handleProgramCombo();
   handleButtons();
   handleCardTap();
-  if (!programmingMode && appMode == AppMode::Running && !actionMenuOpen) {
-    game.onTick();
-    logStateTransition("TICK");
-  }
+  game.hold(programmingMode || appMode != AppMode::Running || actionMenuOpen);
+  timers.run(millis());
   refreshUi();
+  flushCards();
+  idle();
 }
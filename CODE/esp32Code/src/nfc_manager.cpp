@@ -10,17 +10,22 @@ bool NfcManager::begin() {
     return false;
   }
   nfc_.SAMConfig();
+  ready_ = true;
   return true;
 }
 
+void NfcManager::onPollDue(void *self) { static_cast<NfcManager *>(self)->pollDue_ = true; }
+
+// The card left the debounce window: the same UID counts as a new tap
+void NfcManager::onDebounceEnd(void *self) { static_cast<NfcManager *>(self)->lastUidLen_ = 0; }
+
 bool NfcManager::poll(CardTap &tap) {
   tap.valid = false;
-
-  const uint32_t now = millis();
-  if (now - lastPollMs_ < NFC_POLL_MS) {
+  if (!ready_ || !timers_ || !pollDue_) {
     return false;
   }
-  lastPollMs_ = now;
+  // A full timer pool degrades to polling every pass
+  pollDue_ = timers_->start(NFC_POLL_MS, onPollDue, this) == TimerWheel::NONE;
 
   uint8_t uid[7] = {0};
   uint8_t uidLen = 0;
@@ -28,15 +33,18 @@ bool NfcManager::poll(CardTap &tap) {
     return false;
   }
 
-  if (uidLen == lastUidLen_ && memcmp(uid, lastUid_, uidLen) == 0 && (now - lastSeenMs_) < CARD_DEBOUNCE_MS) {
+  if (uidLen == lastUidLen_ && memcmp(uid, lastUid_, uidLen) == 0) {
     return false;
   }
 
   memcpy(lastUid_, uid, uidLen);
   lastUidLen_ = uidLen;
-  lastSeenMs_ = now;
+  timers_->cancel(debounceTimer_);
+  debounceTimer_ = timers_->start(CARD_DEBOUNCE_MS, onDebounceEnd, this);
 
   tap.valid = true;
+  if (++taps_ == 0) taps_ = 1;
+  tap.serial = taps_;
   tap.uidLen = uidLen;
   memcpy(tap.uid, uid, uidLen);
   return true;
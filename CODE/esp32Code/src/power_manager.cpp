@@ -0,0 +1,124 @@
+#include "power_manager.h"
+
+#include <LightSleep.h>  // CODE/lib, shared with UI/v2
+
+#include "config.h"
+
+namespace {
+// Buttons act on release, so they interrupt on both edges; the PN532 IRQ only wakes
+const WakePin kWakePins[] = {{PIN_BTN1, GPIO_INTR_ANYEDGE},
+                             {PIN_BTN2, GPIO_INTR_ANYEDGE},
+                             {PIN_BTN3, GPIO_INTR_ANYEDGE},
+                             {PIN_TOUCH_IRQ, GPIO_INTR_ANYEDGE},
+                             {PIN_NFC_IRQ, GPIO_INTR_DISABLE}};
+
+TaskHandle_t volatile wakeTask = nullptr;
+volatile uint32_t edgeUs = 0;  // first edge not yet handled
+
+void IRAM_ATTR onEdge() {
+  if (!edgeUs) edgeUs = micros();
+  TaskHandle_t t = wakeTask;
+  if (!t) return;
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(t, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+}  // namespace
+
+void PowerManager::begin() {
+  ledcSetup(BL_LEDC_CH, BL_PWM_HZ, 8);
+  ledcAttachPin(PIN_TFT_BL, BL_LEDC_CH);
+  levelMarkMs_ = millis();
+  setBacklight(BL_FULL);
+
+  // Buttons act on release, so both edges wake the loop; PENIRQ needs the pull-up
+  pinMode(PIN_TOUCH_IRQ, INPUT_PULLUP);
+  for (const WakePin &w : kWakePins) {
+    if (w.pin >= 0 && w.edge != GPIO_INTR_DISABLE) attachInterrupt(digitalPinToInterrupt(w.pin), onEdge, CHANGE);
+  }
+  wakeTask = xTaskGetCurrentTaskHandle();
+  lastIdleMs_ = millis();
+  activityMs_ = lastIdleMs_;
+}
+
+void PowerManager::setBacklight(uint8_t level) {
+  account(millis());
+  level_ = level;
+  ledcWrite(BL_LEDC_CH, level);
+}
+
+void PowerManager::account(uint32_t nowMs) {
+  levelMs_ += static_cast<uint64_t>(nowMs - levelMarkMs_) * level_;
+  levelMarkMs_ = nowMs;
+}
+
+PowerStats PowerManager::stats() {
+  account(millis());
+  PowerStats s = stats_;
+  const uint32_t total = s.runMs + s.waitMs + s.sleepMs;
+  if (total) {
+    s.avgMa = (static_cast<float>(s.runMs) * POWER_MA_RUN + static_cast<float>(s.waitMs) * POWER_MA_WAIT +
+               static_cast<float>(s.sleepMs) * POWER_MA_SLEEP +
+               static_cast<float>(levelMs_) * POWER_MA_BACKLIGHT / BL_FULL) /
+              total;
+  }
+  return s;
+}
+
+void PowerManager::activity() {
+  activityMs_ = millis();
+  if (level_ != BL_FULL) setBacklight(BL_FULL);
+}
+
+void PowerManager::onWake(uint32_t atUs) {
+  wakeUs_ = atUs ? atUs : micros();
+  if (level_ == 0) darkWake_ = true;
+  edgeUs = 0;
+  activity();
+}
+
+void PowerManager::rendered() {
+  if (!wakeUs_) return;
+  const uint32_t us = micros() - wakeUs_;
+  wakeUs_ = 0;
+  if (us > WAKE_RESPONSE_MS * 1000UL) return;  // the edge changed nothing on screen
+  stats_.wakes++;
+  stats_.wakeUs = us;
+  if (us > stats_.maxWakeUs) stats_.maxWakeUs = us;
+  if (hook_) hook_(stats());
+}
+
+bool PowerManager::takeDarkWake() {
+  const bool dark = darkWake_;
+  darkWake_ = false;
+  return dark;
+}
+
+void PowerManager::lightSleep(uint32_t waitMs) {
+  uint32_t sleptMs = 0;
+  const bool byPin = lightSleepUntil(kWakePins, waitMs, sleptMs);
+  stats_.sleepMs += sleptMs;
+  stats_.sleeps++;
+  if (byPin) onWake(0);
+}
+
+void PowerManager::idle(uint32_t waitMs, bool mayLightSleep) {
+  const uint32_t now = millis();
+  stats_.runMs += now - lastIdleMs_;
+
+  const uint32_t quiet = now - activityMs_;
+  const uint8_t want = quiet >= SLEEP_AFTER_MS ? 0 : quiet >= DIM_AFTER_MS ? BL_DIM : BL_FULL;
+  if (want < level_) {
+    DBG("[POWER] backlight %u after %lu ms idle", want, static_cast<unsigned long>(quiet));
+    setBacklight(want);
+  }
+
+  if (level_ == 0 && mayLightSleep && waitMs > 0 && wakePinsIdle(kWakePins)) {
+    lightSleep(waitMs);
+  } else {
+    const TickType_t ticks = waitMs == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(waitMs);
+    if (ulTaskNotifyTake(pdTRUE, ticks)) onWake(edgeUs);
+    stats_.waitMs += millis() - now;
+  }
+  lastIdleMs_ = millis();
+}
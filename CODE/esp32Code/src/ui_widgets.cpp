@@ -0,0 +1,112 @@
+#include "ui_widgets.h"
+
+#include <stdio.h>
+#include <string.h>
+
+void TextWidget::place(int16_t x, int16_t y, uint8_t size) {
+  x_ = x;
+  y_ = y;
+  size_ = size;
+  valid_ = false;
+}
+
+bool TextWidget::draw(Adafruit_GFX &gfx, const char *text, uint16_t color, uint16_t bg) {
+  uint8_t len = 0;
+  while (text[len] != '\0' && len < MAX_LEN) len++;
+
+  uint8_t from = 0;
+  if (valid_ && color == color_) {
+    while (from < len && from < len_ && text[from] == text_[from]) from++;
+    if (from == len && len == len_) return false;
+  }
+
+  const int16_t cw = 6 * size_;
+  const int16_t ch = 8 * size_;
+  const uint8_t oldLen = valid_ ? len_ : 0;
+
+  if (from < len) {
+    gfx.setTextSize(size_);
+    gfx.setTextColor(color, bg);
+    gfx.setCursor(x_ + cw * from, y_);
+    for (uint8_t i = from; i < len; i++) gfx.write(text[i]);
+  }
+  if (oldLen > len) {
+    gfx.fillRect(x_ + cw * len, y_, cw * (oldLen - len), ch, bg);
+  }
+
+  memcpy(text_, text, len);
+  text_[len] = '\0';
+  len_ = len;
+  color_ = color;
+  valid_ = true;
+  return true;
+}
+
+bool TextWidget::drawInt(Adafruit_GFX &gfx, const char *prefix, int32_t value, uint16_t color, uint16_t bg) {
+  char buf[MAX_LEN + 1];
+  snprintf(buf, sizeof(buf), "%s%ld", prefix, static_cast<long>(value));
+  return draw(gfx, buf, color, bg);
+}
+
+void TextWidget::clear(Adafruit_GFX &gfx, uint16_t bg) {
+  if (valid_ && len_ > 0) {
+    gfx.fillRect(x_, y_, 6 * size_ * len_, 8 * size_, bg);
+  }
+  len_ = 0;
+  text_[0] = '\0';
+  valid_ = true;
+}
+
+bool FrameWidget::draw(Adafruit_GFX &gfx, int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color,
+                       uint16_t bg) {
+  const bool sameGeometry = valid_ && x == x_ && y == y_ && w == w_ && h == h_ && r == r_;
+  if (sameGeometry && color == color_) return false;
+  if (valid_ && !sameGeometry && w_ > 0) {
+    gfx.drawRoundRect(x_, y_, w_, h_, r_, bg);
+  }
+  gfx.drawRoundRect(x, y, w, h, r, color);
+  x_ = x;
+  y_ = y;
+  w_ = w;
+  h_ = h;
+  r_ = r;
+  color_ = color;
+  valid_ = true;
+  return true;
+}
+
+void FrameWidget::clear(Adafruit_GFX &gfx, uint16_t bg) {
+  if (valid_ && w_ > 0) {
+    gfx.drawRoundRect(x_, y_, w_, h_, r_, bg);
+  }
+  w_ = 0;
+  valid_ = true;
+}
+
+void GlyphWidget::place(int16_t x, int16_t y, uint8_t w, uint8_t h) {
+  x_ = x;
+  y_ = y;
+  w_ = w;
+  h_ = h;
+  valid_ = false;
+}
+
+bool GlyphWidget::draw(Adafruit_GFX &gfx, Painter paint, uint8_t id, uint16_t color, uint16_t bg) {
+  if (valid_ && id == id_ && color == color_) return false;
+  if (valid_ && id_ != 0) {
+    gfx.fillRect(x_, y_, w_, h_, bg);
+  }
+  paint(gfx, x_, y_, id, color);
+  id_ = id;
+  color_ = color;
+  valid_ = true;
+  return true;
+}
+
+void GlyphWidget::clear(Adafruit_GFX &gfx, uint16_t bg) {
+  if (valid_ && id_ != 0) {
+    gfx.fillRect(x_, y_, w_, h_, bg);
+  }
+  id_ = 0;
+  valid_ = true;
+}
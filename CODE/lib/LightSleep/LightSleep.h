@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Arduino.h>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+
+// Light sleep to a deadline with GPIO wake, shared by both firmwares. Both
+// cores stall and LEDC stops, so callers only sleep with the screen dark.
+
+struct WakePin {
+  int8_t pin;            // -1 = not fitted
+  gpio_int_type_t edge;  // the pin's ISR edge; GPIO_INTR_DISABLE = no ISR attached
+};
+
+// GPIO wake is level-triggered and shares the pin's interrupt type. The ISR is
+// masked before the type becomes LOW_LEVEL (a pin held low would otherwise
+// re-enter it until the chip sleeps) and unmasked once the edge is back.
+template <size_t N>
+void armWakePins(const WakePin (&pins)[N], bool on) {
+  for (const WakePin &w : pins) {
+    if (w.pin < 0) continue;
+    const gpio_num_t pin = static_cast<gpio_num_t>(w.pin);
+    if (on) {
+      if (w.edge != GPIO_INTR_DISABLE) gpio_intr_disable(pin);
+      gpio_wakeup_enable(pin, GPIO_INTR_LOW_LEVEL);
+    } else {
+      gpio_wakeup_disable(pin);
+      if (w.edge != GPIO_INTR_DISABLE) {
+        gpio_set_intr_type(pin, w.edge);
+        gpio_intr_enable(pin);
+      }
+    }
+  }
+}
+
+// A pin already low would end the sleep at once
+template <size_t N>
+bool wakePinsIdle(const WakePin (&pins)[N]) {
+  for (const WakePin &w : pins) {
+    if (w.pin >= 0 && digitalRead(w.pin) == LOW) return false;
+  }
+  return true;
+}
+
+// Sleeps until a wake pin goes low or waitMs pass (UINT32_MAX: pins only).
+// Returns true when a pin ended it; sleptMs gets the time spent asleep.
+template <size_t N>
+bool lightSleepUntil(const WakePin (&pins)[N], uint32_t waitMs, uint32_t &sleptMs) {
+  armWakePins(pins, true);
+  esp_sleep_enable_gpio_wakeup();
+  if (waitMs != UINT32_MAX) esp_sleep_enable_timer_wakeup(static_cast<uint64_t>(waitMs) * 1000ULL);
+
+  const uint32_t t0 = millis();
+  esp_light_sleep_start();
+  sleptMs = millis() - t0;
+
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+  armWakePins(pins, false);
+  return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO;
+}
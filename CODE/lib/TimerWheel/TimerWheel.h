@@ -0,0 +1,228 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Hierarchical timer wheel shared by both firmwares (esp32Code's TimerWheel,
+// UI/v2's tw_ module). Three wheels of 64 slots at TICK_MS (0.64 s, 41 s,
+// 44 min spans); a timer sits in the slot of its deadline and moves down a
+// wheel when the coarser wheel's slot comes up, so start() and cancel() are
+// O(1) and run() only touches timers that are due or cascading. Timers live in
+// a fixed pool of MaxTimers. Not thread-safe: one core owns each wheel.
+template <uint8_t MaxTimers>
+class BasicTimerWheel {
+  static_assert(MaxTimers > 0 && MaxTimers < 0xFF, "timer index must fit below NIL");
+
+ public:
+  static constexpr uint8_t MAX_TIMERS = MaxTimers;
+  static constexpr uint32_t TICK_MS = 10;
+
+  using Callback = void (*)(void *ctx);
+  using Id = uint16_t;  // slot | generation << 8; 0 = none
+  static constexpr Id NONE = 0;
+
+  // Fires cb(ctx) from run() once delayMs have passed (at least one tick).
+  // NONE when the pool is full.
+  Id start(uint32_t delayMs, Callback cb, void *ctx);
+  void cancel(Id &id);  // no-op for NONE or a timer that already fired
+  bool pending(Id id) const;
+  uint32_t msLeft(Id id, uint32_t nowMs) const;  // 0 when due or not pending
+
+  void begin(uint32_t nowMs);
+  void run(uint32_t nowMs);                    // fire everything due
+  uint32_t msUntilNext(uint32_t nowMs) const;  // UINT32_MAX when idle
+  uint8_t active() const { return active_; }
+
+ private:
+  static constexpr uint8_t SLOT_BITS = 6;
+  static constexpr uint8_t SLOTS = 1 << SLOT_BITS;
+  static constexpr uint8_t LEVELS = 3;
+  static constexpr uint8_t NIL = 0xFF;
+
+  struct Timer {
+    Callback cb = nullptr;
+    void *ctx = nullptr;
+    uint32_t dueTick = 0;
+    uint8_t prev = NIL;
+    uint8_t next = NIL;
+    uint8_t generation = 1;
+    uint8_t bucket = NIL;  // level * SLOTS + slot, NIL = free
+  };
+
+  void link(uint8_t index);
+  void unlink(uint8_t index);
+  void release(uint8_t index);
+  void cascade(uint8_t level);
+
+  Timer timers_[MaxTimers];
+  uint8_t heads_[LEVELS * SLOTS];
+  uint32_t tick_ = 0;    // last processed tick
+  uint32_t tickMs_ = 0;  // millis() at tick_
+  uint8_t free_ = NIL;   // free list through Timer::next
+  uint8_t active_ = 0;
+  bool begun_ = false;
+};
+
+template <uint8_t N>
+void BasicTimerWheel<N>::begin(uint32_t nowMs) {
+  for (uint8_t &h : heads_) h = NIL;
+  for (uint8_t i = 0; i < N; i++) {
+    Timer &t = timers_[i];
+    t = Timer{};
+    t.next = (i + 1 < N) ? i + 1 : NIL;
+  }
+  free_ = 0;
+  tick_ = 0;
+  tickMs_ = nowMs;
+  active_ = 0;
+  begun_ = true;
+}
+
+template <uint8_t N>
+typename BasicTimerWheel<N>::Id BasicTimerWheel<N>::start(uint32_t delayMs, Callback cb, void *ctx) {
+  if (!begun_) begin(millis());
+  if (!cb || free_ == NIL) return NONE;
+
+  const uint8_t index = free_;
+  Timer &t = timers_[index];
+  free_ = t.next;
+  t.cb = cb;
+  t.ctx = ctx;
+  // Round up, and never into a tick run() has already processed
+  const uint32_t ahead = millis() - tickMs_ + delayMs;
+  t.dueTick = tick_ + (ahead < TICK_MS ? 1 : (ahead + TICK_MS - 1) / TICK_MS);
+  link(index);
+  active_++;
+  return static_cast<Id>(index | (t.generation << 8));
+}
+
+template <uint8_t N>
+void BasicTimerWheel<N>::cancel(Id &id) {
+  if (pending(id)) {
+    const uint8_t index = id & 0xFF;
+    unlink(index);
+    release(index);
+  }
+  id = NONE;
+}
+
+template <uint8_t N>
+bool BasicTimerWheel<N>::pending(Id id) const {
+  const uint8_t index = id & 0xFF;
+  if (id == NONE || index >= N) return false;
+  const Timer &t = timers_[index];
+  return t.bucket != NIL && t.generation == (id >> 8);
+}
+
+// Wheel 0 holds the next 64 ticks one per slot, wheel 1 the next 64 x 64 and
+// wheel 2 the rest (capped at its span).
+template <uint8_t N>
+void BasicTimerWheel<N>::link(uint8_t index) {
+  Timer &t = timers_[index];
+  uint32_t delta = t.dueTick - tick_;
+  constexpr uint32_t kSpan = 1UL << (SLOT_BITS * LEVELS);
+  if (delta >= kSpan) {
+    delta = kSpan - 1;
+    t.dueTick = tick_ + delta;
+  }
+  uint8_t level = 0;
+  while (level + 1 < LEVELS && delta >= (1UL << (SLOT_BITS * (level + 1)))) level++;
+  const uint8_t slot = (t.dueTick >> (SLOT_BITS * level)) & (SLOTS - 1);
+  const uint8_t bucket = level * SLOTS + slot;
+
+  t.bucket = bucket;
+  t.prev = NIL;
+  t.next = heads_[bucket];
+  if (t.next != NIL) timers_[t.next].prev = index;
+  heads_[bucket] = index;
+}
+
+template <uint8_t N>
+void BasicTimerWheel<N>::unlink(uint8_t index) {
+  Timer &t = timers_[index];
+  if (t.prev != NIL) {
+    timers_[t.prev].next = t.next;
+  } else {
+    heads_[t.bucket] = t.next;
+  }
+  if (t.next != NIL) timers_[t.next].prev = t.prev;
+  t.prev = NIL;
+  t.next = NIL;
+}
+
+template <uint8_t N>
+void BasicTimerWheel<N>::release(uint8_t index) {
+  Timer &t = timers_[index];
+  t.cb = nullptr;
+  t.ctx = nullptr;
+  t.bucket = NIL;
+  // Stale ids stop matching; generation 0 is skipped so NONE stays unique
+  if (++t.generation == 0) t.generation = 1;
+  t.next = free_;
+  free_ = index;
+  active_--;
+}
+
+// The coarser wheel's current slot is due within the finer wheel's span now:
+// move its timers down.
+template <uint8_t N>
+void BasicTimerWheel<N>::cascade(uint8_t level) {
+  const uint8_t bucket = level * SLOTS + ((tick_ >> (SLOT_BITS * level)) & (SLOTS - 1));
+  uint8_t index = heads_[bucket];
+  heads_[bucket] = NIL;
+  while (index != NIL) {
+    const uint8_t next = timers_[index].next;
+    link(index);
+    index = next;
+  }
+}
+
+template <uint8_t N>
+void BasicTimerWheel<N>::run(uint32_t nowMs) {
+  if (!begun_) begin(nowMs);
+  // Whole ticks since the last run; millis() wrap-safe
+  const uint32_t ticks = (nowMs - tickMs_) / TICK_MS;
+  tickMs_ += ticks * TICK_MS;
+  const uint32_t target = tick_ + ticks;
+
+  while (active_ > 0 && tick_ != target) {
+    tick_++;
+    if ((tick_ & (SLOTS - 1)) == 0) {
+      if ((tick_ & ((1UL << (SLOT_BITS * 2)) - 1)) == 0) cascade(2);
+      cascade(1);
+    }
+    uint8_t &head = heads_[tick_ & (SLOTS - 1)];
+    while (head != NIL) {
+      // Free the timer before the callback so it can re-arm itself
+      const uint8_t index = head;
+      const Callback cb = timers_[index].cb;
+      void *ctx = timers_[index].ctx;
+      unlink(index);
+      release(index);
+      cb(ctx);
+    }
+  }
+  tick_ = target;  // nothing pending: skip the idle ticks
+}
+
+template <uint8_t N>
+uint32_t BasicTimerWheel<N>::msLeft(Id id, uint32_t nowMs) const {
+  if (!pending(id)) return 0;
+  const Timer &t = timers_[id & 0xFF];
+  const uint32_t dueMs = tickMs_ + (t.dueTick - tick_) * TICK_MS;
+  const int32_t left = static_cast<int32_t>(dueMs - nowMs);
+  return left > 0 ? static_cast<uint32_t>(left) : 0;
+}
+
+// Scans the pool rather than the wheels: a handful of entries, and only when
+// the loop is about to sleep
+template <uint8_t N>
+uint32_t BasicTimerWheel<N>::msUntilNext(uint32_t nowMs) const {
+  if (active_ == 0) return UINT32_MAX;
+  uint32_t best = UINT32_MAX;
+  for (uint8_t i = 0; i < N; i++) {
+    if (timers_[i].bucket == NIL) continue;
+    const uint32_t ms = msLeft(static_cast<Id>(i | (timers_[i].generation << 8)), nowMs);
+    if (ms < best) best = ms;
+  }
+  return best;
+}